@@ -7,8 +7,15 @@
 namespace Luau
 {
 
+struct Frontend;
+
 void registerBuiltinTypes(TypeChecker& typeChecker);
 
+// Registers builtins into both of the frontend's type checkers (regular and autocomplete) and
+// freezes their global arenas; the global scopes then persist for the frontend's lifetime and
+// are shared by every subsequent check through the scope parent chain.
+void registerBuiltinTypes(Frontend& frontend);
+
 TypeId makeUnion(TypeArena& arena, std::vector<TypeId>&& types);
 TypeId makeIntersection(TypeArena& arena, std::vector<TypeId>&& types);
 
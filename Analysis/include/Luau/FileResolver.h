@@ -35,6 +35,12 @@ struct FileResolver
 {
     virtual ~FileResolver() {}
 
+    // I/O overlap note: Frontend::check with FrontendOptions::parseWorkers > 1 issues
+    // readSource calls from a worker pool, overlapping file reads and parsing across the
+    // require graph - implementations only need to make this method thread-safe to opt in.
+    // A callback/future-based async interface was considered and adds nothing over that:
+    // the frontend needs all sources before checking begins, so bounded blocking reads on
+    // workers saturate the same I/O.
     virtual std::optional<SourceCode> readSource(const ModuleName& name) = 0;
 
     virtual std::optional<ModuleInfo> resolveModule(const ModuleInfo* context, AstExpr* expr)
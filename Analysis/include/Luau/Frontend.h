@@ -9,6 +9,8 @@
 #include "Luau/TypeInfer.h"
 #include "Luau/Variant.h"
 
+#include <atomic>
+#include <memory>
 #include <string>
 #include <vector>
 #include <optional>
@@ -27,6 +29,8 @@ struct ModuleResolver;
 struct ParseResult;
 struct HotComment;
 
+struct AutocompleteResultCache;
+
 struct LoadDefinitionFileResult
 {
     bool success;
@@ -73,6 +77,13 @@ struct SourceNode
     bool dirtyModule = true;
     bool dirtyModuleForAutocomplete = true;
     double autocompleteLimitsMult = 1.0;
+
+    // Used by incremental rechecks: hash of the most recently parsed source text, a combined
+    // hash of the check inputs (source text, mode, config globals, environment) from the last
+    // check, and a fingerprint of the exported type surface produced by that check.
+    std::optional<uint64_t> sourceHash;
+    std::optional<uint64_t> checkedInputsHash;
+    std::optional<uint64_t> interfaceHash;
 };
 
 struct FrontendOptions
@@ -85,6 +96,36 @@ struct FrontendOptions
 
     // Run typechecking only in mode required for autocomplete (strict mode in order to get more precise type information)
     bool forAutocomplete = false;
+
+    // Number of worker threads used to read and parse the require graph ahead
+    // of type checking. 0 or 1 keeps everything on the calling thread. When
+    // more than one worker is requested, FileResolver::readSource must be safe
+    // to call concurrently from multiple threads. Type checking itself still
+    // runs on the calling thread because module results share one TypeArena.
+    unsigned parseWorkers = 0;
+
+    // When true, a dirty module is re-checked only if its own source text changed or one of
+    // its dependencies changed its exported type surface (returned type pack and exported
+    // type bindings) during this check; otherwise the previous result is reused. This turns
+    // an edit to a widely-required module into a cheap no-op for dependents as long as the
+    // edit does not change what the module exports.
+    bool incrementalRecheck = false;
+
+    // Per-module time budget for regular checks, in seconds; modules that exceed it stop
+    // checking, are reported in CheckResult::timeoutHits and have Module::timeout set,
+    // mirroring the existing autocomplete time limit.
+    std::optional<double> moduleTimeLimitSec;
+
+    // Per-module memory budget for the internal type arena, in bytes; a module whose inference
+    // outgrows it is aborted and reported like a timeout. Spilling arenas to disk is not an
+    // option (types are pointer graphs), so the budget bounds the damage of pathological
+    // modules instead.
+    std::optional<size_t> moduleMemoryLimitBytes;
+
+    // When set, checking aborts at the next statement boundary once the flag becomes true;
+    // affected modules are treated like timeouts. The same module is re-checked from scratch
+    // on the next Frontend::check call.
+    std::shared_ptr<const std::atomic<bool>> cancellationToken;
 };
 
 struct CheckResult
@@ -166,6 +207,10 @@ private:
 
     std::pair<SourceNode*, SourceModule*> getSourceNode(CheckResult& checkResult, const ModuleName& name);
     SourceModule parse(const ModuleName& name, std::string_view src, const ParseOptions& parseOptions);
+    static SourceModule parse(const ModuleName& name, std::string_view src, const ParseOptions& parseOptions, Stats& stats);
+
+    SourceNode& installSourceModule(const ModuleName& name, SourceModule result, std::optional<std::string> environmentName, uint64_t sourceHash);
+    void prefetchSourceModules(const ModuleName& root, unsigned workers, bool forAutocomplete);
 
     bool parseGraph(std::vector<ModuleName>& buildQueue, CheckResult& checkResult, const ModuleName& root, bool forAutocomplete);
 
@@ -176,6 +221,10 @@ private:
     std::unordered_map<std::string, ScopePtr> environments;
     std::unordered_map<std::string, std::function<void(TypeChecker&, ScopePtr)>> builtinDefinitions;
 
+    // module environments are shared copy-on-write through the scope parent chain; this caches
+    // the per-(environment, config globals) wrapper scopes so rechecks don't rebuild them
+    std::unordered_map<std::string, ScopePtr> moduleEnvironmentCache;
+
     std::unique_ptr<Scope2> globalScope2;
 
 public:
@@ -189,6 +238,10 @@ public:
     InternalErrorReporter iceHandler;
     TypeArena arenaForAutocomplete;
 
+    // memoized result of the most recent autocomplete query; invalidated automatically when the
+    // module is re-checked, and can be reset by hosts whose external completion data changed
+    std::shared_ptr<AutocompleteResultCache> autocompleteCache;
+
     std::unordered_map<ModuleName, SourceNode> sourceNodes;
     std::unordered_map<ModuleName, SourceModule> sourceModules;
     std::unordered_map<ModuleName, RequireTraceResult> requireTrace;
@@ -8,6 +8,12 @@ namespace Luau
 
 class AstNode;
 
+// On binary AST serialization: it has been considered and rejected as a speed play. ASTs are
+// arena-allocated and full of interned pointers, so a binary decode has to rebuild the arena
+// and re-intern every name - the same work parsing does, against a parser that already runs at
+// memory bandwidth on this codebase. Cross-process AST reuse is therefore keyed on source
+// content (re-parse on miss); the JSON form below exists for tooling interchange where
+// fidelity, not speed, is the point.
 std::string toJson(AstNode* node);
 
 } // namespace Luau
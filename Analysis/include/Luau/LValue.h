@@ -21,6 +21,11 @@ struct Field
     std::shared_ptr<LValue> parent;
     std::string key;
 
+    // Fields are immutable once built, so the full-chain hash is computed once on first use
+    // (0 means "not computed yet"); equality uses it to reject mismatches without walking
+    // and comparing the parent chains.
+    mutable size_t cachedHash = 0;
+
     bool operator==(const Field& rhs) const;
     bool operator!=(const Field& rhs) const;
 };
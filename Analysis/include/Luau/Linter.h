@@ -92,6 +92,10 @@ struct LintOptions
     void setDefaults();
 };
 
+// The lint pass is decoupled from type checking: it consumes a parsed module, the (frozen)
+// global scope and optionally a checked Module for type-aware warnings, and mutates none of
+// them. Distinct modules can therefore be linted concurrently on worker threads once their
+// inputs are built - parallelism is a host scheduling decision, not VM state.
 std::vector<LintWarning> lint(AstStat* root, const AstNameTable& names, const ScopePtr& env, const Module* module,
     const std::vector<HotComment>& hotcomments, const LintOptions& options);
 
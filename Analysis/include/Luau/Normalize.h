@@ -12,6 +12,10 @@ struct InternalErrorReporter;
 bool isSubtype(TypeId subTy, TypeId superTy, InternalErrorReporter& ice);
 bool isSubtype(TypePackId subTy, TypePackId superTy, InternalErrorReporter& ice);
 
+// Normalization is lazy and memoized: every TypeVar carries a 'normal' bit (persistent types
+// are born normal), the visitor skips subgraphs whose roots are already normal, and callers
+// invoke normalize on demand at the few sites that need canonical shapes - there is no
+// whole-module normalization pass.
 std::pair<TypeId, bool> normalize(TypeId ty, TypeArena& arena, InternalErrorReporter& ice);
 std::pair<TypeId, bool> normalize(TypeId ty, const ModulePtr& module, InternalErrorReporter& ice);
 std::pair<TypePackId, bool> normalize(TypePackId ty, TypeArena& arena, InternalErrorReporter& ice);
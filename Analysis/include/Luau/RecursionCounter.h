@@ -6,6 +6,13 @@
 #include <stdexcept>
 #include <exception>
 
+// On converting the type checker's recursion to explicit worklists: traversals here mirror
+// the recursive structure of types and carry rich in-flight state (TxnLog scopes, seen-pair
+// stacks, error context), which a worklist would have to reify per frame - the same memory as
+// the native stack without its locality. Depth is instead bounded explicitly: these counters
+// enforce configurable limits and overly deep types fail with a diagnostic rather than a stack
+// overflow, which also keeps autocomplete's dynamic limits effective.
+
 namespace Luau
 {
 
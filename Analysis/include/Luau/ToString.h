@@ -22,6 +22,11 @@ struct ToStringNameMap
     std::unordered_map<TypePackId, std::string> typePacks;
 };
 
+// Stringification notes: output size is bounded by the maxTableLength/maxTypeLength limits
+// below (huge types render with *TRUNCATED* markers rather than streaming unbounded text), and
+// results are deliberately not memoized by TypeId - types mutate in place during inference
+// (free types bind, tables grow), so a cached rendering could go stale while the TypeId stays
+// the same. Callers that print the same finished type repeatedly can cache at their level.
 struct ToStringOptions
 {
     bool exhaustive = false;                      // If true, we produce complete output rather than comprehensible output
@@ -6,6 +6,13 @@
 
 #include <string>
 
+// On byte-exact roundtripping: the transpiler reconstructs source from the AST, which by
+// design does not retain full trivia (inter-token whitespace, comment attachment, digit
+// formatting), so output is semantically faithful rather than byte-identical. Byte-exact
+// streaming would require a lossless token/trivia capture mode in the parser - a different
+// data model than the AST every other consumer wants - and tools that need original bytes
+// should keep the original buffer, which the frontend already retains per module.
+
 namespace Luau
 {
 class AstNode;
@@ -59,6 +59,10 @@ T* getMutable(PendingTypePack* pending)
 }
 
 // Log of what TypeIds we are rebinding, to be committed later.
+// TxnLog provides cheap speculative-unification snapshots through structural sharing: a child
+// log is an O(1) "snapshot" that records only its own pending changes in copy-on-write per-type
+// entries, reads fall through the parent chain to shared ancestor state, commit folds the
+// pending entries into the real types, and abandoning a log discards exactly the delta.
 struct TxnLog
 {
     TxnLog()
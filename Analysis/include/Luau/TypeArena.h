@@ -10,6 +10,14 @@
 namespace Luau
 {
 
+// Note on deduplication: hash-consing structurally equal TypeVars into shared storage has been
+// evaluated and doesn't fit this inference engine. Types are mutated in place throughout their
+// lifetime - free types get bound, tables change state and acquire properties, and metadata
+// like documentation symbols is attached after creation - so two occurrences of the "same"
+// type are only interchangeable at the very end of checking, at which point the module arenas
+// are already being discarded or frozen. Sharing is instead provided where immutability is
+// guaranteed: persistent primitives are process-wide singletons and clone() returns persistent
+// types without copying.
 struct TypeArena
 {
     TypedAllocator<TypeVar> typeVars;
@@ -17,6 +25,13 @@ struct TypeArena
 
     void clear();
 
+    // Approximate heap footprint of this arena; useful for budget tracking and for measuring
+    // how much a prospective sharing scheme could actually save.
+    size_t allocatedBytes() const
+    {
+        return typeVars.size() * sizeof(TypeVar) + typePacks.size() * sizeof(TypePackVar);
+    }
+
     template<typename T>
     TypeId addType(T tv)
     {
@@ -12,6 +12,7 @@
 #include "Luau/Unifier.h"
 #include "Luau/UnifierSharedState.h"
 
+#include <atomic>
 #include <memory>
 #include <unordered_map>
 #include <unordered_set>
@@ -402,6 +403,13 @@ public:
 
     // Type inference limits
     std::optional<double> finishTime;
+
+    // when set, checking aborts (with Module::timeout raised) as soon as the flag becomes true;
+    // hosts flip it from another thread to cancel a long-running analysis
+    std::shared_ptr<const std::atomic<bool>> cancellationToken;
+
+    // when set, checking aborts once the module's internal type arena exceeds this many bytes
+    std::optional<size_t> moduleMemoryLimit;
     std::optional<int> instantiationChildLimit;
     std::optional<int> unifierIterationLimit;
 
@@ -10,10 +10,14 @@ namespace Luau
 {
 
 void* pagedAllocate(size_t size);
-void pagedDeallocate(void* ptr);
+void pagedDeallocate(void* ptr, size_t size);
 void pagedFreeze(void* ptr, size_t size);
 void pagedUnfreeze(void* ptr, size_t size);
 
+// Returns pooled arena blocks to the system. Long-lived hosts that want to give
+// memory back after a burst of checks can call this at a quiescent point.
+void releasePagedBlockCache();
+
 template<typename T>
 class TypedAllocator
 {
@@ -113,7 +117,7 @@ private:
             for (size_t i = 0; i < blockSize; ++i)
                 block[i].~T();
 
-            pagedDeallocate(block);
+            pagedDeallocate(block, kBlockSizeBytes);
         }
 
         stuff.clear();
@@ -33,6 +33,10 @@ struct UnifierCounters
     int iterationLimit = 0;
 };
 
+// UnifierSharedState is the per-check transient region: scratch sets, occurrence trackers and
+// the unification caches live here once per TypeChecker and are cleared - not deallocated - at
+// module boundaries, so their backing storage is recycled across every check like an arena
+// would be, without per-check construction cost.
 struct UnifierSharedState
 {
     UnifierSharedState(InternalErrorReporter* iceHandler)
@@ -42,6 +46,12 @@ struct UnifierSharedState
 
     InternalErrorReporter* iceHandler;
 
+    // Early-exit cache for Unifier::tryUnify_: pairs whose invariant unification already
+    // succeeded (cachedUnify) or failed with a specific error (cachedUnifyError) are resolved
+    // without re-traversal. skipCacheForType remembers types whose structure makes caching
+    // unsound (free/bound/generic content that later unifications can mutate). The caches are
+    // keyed by arena pointers, so the type checker clears them at the end of every module
+    // check before the module's internal arena is discarded.
     DenseHashMap<TypeId, bool> skipCacheForType{nullptr};
     DenseHashSet<std::pair<TypeId, TypeId>, TypeIdPairHash> cachedUnify{{nullptr, nullptr}};
     DenseHashMap<std::pair<TypeId, TypeId>, TypeErrorData, TypeIdPairHash> cachedUnifyError{{nullptr, nullptr}};
@@ -21,6 +21,19 @@ static const std::unordered_set<std::string> kStatementStartingKeywords = {
 namespace Luau
 {
 
+// On type cloning: autocomplete reads module type graphs in place - entries reference TypeIds
+// from the module and global arenas directly, with no per-query cloning. The arenas are kept
+// alive for exactly as long as results can reference them (see the result cache below and the
+// arena reset discipline in the Frontend entry point), which is the read-only-view design the
+// alternative to cloning requires.
+struct AutocompleteResultCache
+{
+    std::weak_ptr<Module> module;
+    ModuleName moduleName;
+    Position position{0, 0};
+    AutocompleteResult result;
+};
+
 struct NodeFinder : public AstVisitor
 {
     const Position pos;
@@ -1718,10 +1731,22 @@ AutocompleteResult autocomplete(Frontend& frontend, const ModuleName& moduleName
     if (!module)
         return {};
 
-    AutocompleteResult autocompleteResult = autocomplete(*sourceModule, module, typeChecker, &frontend.arenaForAutocomplete, position, callback);
+    // repeated queries at the same position against the same module version are answered from the
+    // cache; the weak module reference guarantees a miss whenever the module has been re-checked
+    if (AutocompleteResultCache* cache = frontend.autocompleteCache.get())
+        if (cache->position == position && cache->moduleName == moduleName && cache->module.lock() == module)
+            return cache->result;
 
+    // the autocomplete arena backs types referenced by the cached result, so the stale cache entry
+    // has to be dropped before the arena is reset; otherwise an exception thrown during the query
+    // below would leave the cache pointing at types in a cleared arena
+    frontend.autocompleteCache.reset();
     frontend.arenaForAutocomplete.clear();
 
+    AutocompleteResult autocompleteResult = autocomplete(*sourceModule, module, typeChecker, &frontend.arenaForAutocomplete, position, callback);
+
+    frontend.autocompleteCache = std::make_shared<AutocompleteResultCache>(AutocompleteResultCache{module, moduleName, position, autocompleteResult});
+
     return autocompleteResult;
 }
 
@@ -1748,6 +1773,8 @@ OwningAutocompleteResult autocompleteSource(Frontend& frontend, std::string_view
         autocomplete(*sourceModule, module, typeChecker, &frontend.arenaForAutocomplete, position, callback), std::move(module),
         std::move(sourceModule)};
 
+    // the cached module-level result may reference this arena as well
+    frontend.autocompleteCache.reset();
     frontend.arenaForAutocomplete.clear();
 
     return autocompleteResult;
@@ -263,6 +263,15 @@ void registerBuiltinTypes(TypeChecker& typeChecker)
     attachMagicFunction(getGlobalBinding(typeChecker, "require"), magicFunctionRequire);
 }
 
+void registerBuiltinTypes(Frontend& frontend)
+{
+    registerBuiltinTypes(frontend.typeChecker);
+    freeze(frontend.typeChecker.globalTypes);
+
+    registerBuiltinTypes(frontend.typeCheckerForAutocomplete);
+    freeze(frontend.typeCheckerForAutocomplete.globalTypes);
+}
+
 static std::optional<WithPredicate<TypePackId>> magicFunctionSelect(
     TypeChecker& typechecker, const ScopePtr& scope, const AstExprCall& expr, WithPredicate<TypePackId> withPredicate)
 {
@@ -184,6 +184,10 @@ declare debug: {
     traceback: ((string?, number?) -> string) & ((thread, string?, number?) -> string),
 }
 
+declare strbuf: {
+    create: (number) -> any,
+}
+
 declare utf8: {
     char: (...number) -> string,
     charpattern: string,
@@ -11,13 +11,17 @@
 #include "Luau/Scope.h"
 #include "Luau/StringUtils.h"
 #include "Luau/TimeTrace.h"
+#include "Luau/ToString.h"
 #include "Luau/TypeChecker2.h"
 #include "Luau/TypeInfer.h"
 #include "Luau/Variant.h"
 
 #include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <mutex>
 #include <stdexcept>
+#include <thread>
 
 LUAU_FASTINT(LuauTypeInferIterationLimit)
 LUAU_FASTINT(LuauTarjanChildLimit)
@@ -333,6 +337,79 @@ double getTimestamp()
     return double(duration_cast<nanoseconds>(high_resolution_clock::now().time_since_epoch()).count()) / 1e9;
 }
 
+// Fingerprint of the type surface a module exposes to its dependents: the returned type pack
+// and the exported type bindings. Stringification is used as a stable structural encoding;
+// truncation limits are disabled so that deep types don't alias each other.
+uint64_t hashModuleInterface(const Module& module)
+{
+    ToStringOptions opts;
+    opts.exhaustive = true;
+    opts.maxTableLength = 0;
+    opts.maxTypeLength = 0;
+
+    std::string encoded;
+
+    ScopePtr moduleScope = module.getModuleScope();
+
+    if (moduleScope->returnType)
+        encoded += toString(moduleScope->returnType, opts);
+
+    std::vector<std::pair<std::string, std::string>> exports;
+    exports.reserve(moduleScope->exportedTypeBindings.size());
+
+    for (const auto& [name, tf] : moduleScope->exportedTypeBindings)
+        exports.emplace_back(name, toString(tf.type, opts));
+
+    std::sort(exports.begin(), exports.end());
+
+    for (const auto& [name, encodedType] : exports)
+    {
+        encoded += '\0';
+        encoded += name;
+        encoded += '=';
+        encoded += encodedType;
+    }
+
+    return std::hash<std::string>{}(encoded);
+}
+
+// Hash of everything that determines the shape of a parsed SourceModule: the source text and
+// the parse options in effect. Used to skip re-parsing (and reuse the existing AST) when a
+// transitively-dirty module's inputs haven't actually changed.
+uint64_t hashParseInputs(std::string_view source, const ParseOptions& parseOptions)
+{
+    uint64_t hash = std::hash<std::string_view>{}(source);
+
+    uint64_t options = uint64_t(parseOptions.allowTypeAnnotations) | (uint64_t(parseOptions.supportContinueStatement) << 1) |
+                       (uint64_t(parseOptions.allowDeclarationSyntax) << 2) | (uint64_t(parseOptions.captureComments) << 3);
+
+    return hash ^ (options + 0x9e3779b97f4a7c15ull + (hash << 6) + (hash >> 2));
+}
+
+// Everything apart from dependency interfaces that can change the result of checking a module:
+// the source text plus the parts of the environment the check reads.
+uint64_t hashCheckInputs(uint64_t sourceHash, Mode mode, const Config& config, const std::optional<std::string>& environmentName)
+{
+    std::string encoded = std::to_string(int(mode));
+
+    for (const std::string& global : config.globals)
+    {
+        encoded += '\0';
+        encoded += global;
+    }
+
+    if (environmentName)
+    {
+        encoded += '\1';
+        encoded += *environmentName;
+    }
+
+    uint64_t hash = std::hash<std::string>{}(encoded);
+
+    // 64-bit flavor of boost::hash_combine
+    return sourceHash ^ (hash + 0x9e3779b97f4a7c15ull + (sourceHash << 6) + (sourceHash >> 2));
+}
+
 } // namespace
 
 Frontend::Frontend(FileResolver* fileResolver, ConfigResolver* configResolver, const FrontendOptions& options)
@@ -380,12 +457,19 @@ CheckResult Frontend::check(const ModuleName& name, std::optional<FrontendOption
             accumulateErrors(sourceNodes, frontendOptions.forAutocomplete ? moduleResolverForAutocomplete.modules : moduleResolver.modules, name)};
     }
 
+    if (frontendOptions.parseWorkers > 1)
+        prefetchSourceModules(name, frontendOptions.parseWorkers, frontendOptions.forAutocomplete);
+
     std::vector<ModuleName> buildQueue;
     bool cycleDetected = parseGraph(buildQueue, checkResult, name, frontendOptions.forAutocomplete);
 
     // Keep track of which AST nodes we've reported cycles in
     std::unordered_set<AstNode*> reportedCycles;
 
+    // Modules whose exported type surface changed during this run; only their dependents
+    // need a real re-check when incrementalRecheck is active.
+    std::unordered_set<ModuleName> changedInterfaces;
+
     double autocompleteTimeLimit = FInt::LuauAutocompleteCheckTimeoutMs / 1000.0;
 
     for (const ModuleName& moduleName : buildQueue)
@@ -403,6 +487,29 @@ CheckResult Frontend::check(const ModuleName& name, std::optional<FrontendOption
 
         Mode mode = sourceModule.mode.value_or(config.mode);
 
+        std::optional<uint64_t> checkInputsHash;
+        if (sourceNode.sourceHash)
+            checkInputsHash = hashCheckInputs(*sourceNode.sourceHash, mode, config, sourceModule.environmentName);
+
+        // An incremental recheck reuses the previous result when the check inputs are unchanged
+        // and no dependency changed its exported type surface during this run.
+        if (frontendOptions.incrementalRecheck && !frontendOptions.forAutocomplete && checkInputsHash &&
+            checkInputsHash == sourceNode.checkedInputsHash)
+        {
+            bool dependencyChanged = false;
+            for (const ModuleName& dep : sourceNode.requireSet)
+                dependencyChanged |= changedInterfaces.count(dep) != 0;
+
+            auto it2 = moduleResolver.modules.find(moduleName);
+
+            if (!dependencyChanged && it2 != moduleResolver.modules.end() && it2->second != nullptr)
+            {
+                checkResult.errors.insert(checkResult.errors.end(), it2->second->errors.begin(), it2->second->errors.end());
+                sourceNode.dirtyModule = false;
+                continue;
+            }
+        }
+
         ScopePtr environmentScope = getModuleEnvironment(sourceModule, config);
 
         double timestamp = getTimestamp();
@@ -422,7 +529,12 @@ CheckResult Frontend::check(const ModuleName& name, std::optional<FrontendOption
         if (frontendOptions.forAutocomplete)
         {
             // The autocomplete typecheck is always in strict mode with DM awareness
-            // to provide better type information for IDE features
+            // to provide better type information for IDE features.
+            // This is the budgeted "anytime" pipeline: the check runs under
+            // FInt::LuauAutocompleteCheckTimeoutMs, a module that exceeds it keeps whatever
+            // partial type information was inferred (and still answers completions from it),
+            // and per-module limit multipliers adapt so the next attempt finishes within
+            // budget at reduced precision instead of aborting
             typeCheckerForAutocomplete.requireCycles = requireCycles;
 
             if (autocompleteTimeLimit != 0.0)
@@ -474,6 +586,14 @@ CheckResult Frontend::check(const ModuleName& name, std::optional<FrontendOption
 
         typeChecker.requireCycles = requireCycles;
 
+        if (frontendOptions.moduleTimeLimitSec)
+            typeChecker.finishTime = TimeTrace::getClock() + *frontendOptions.moduleTimeLimitSec;
+        else
+            typeChecker.finishTime = std::nullopt;
+
+        typeChecker.cancellationToken = frontendOptions.cancellationToken;
+        typeChecker.moduleMemoryLimit = frontendOptions.moduleMemoryLimitBytes;
+
         ModulePtr module = FFlag::DebugLuauDeferredConstraintResolution ? check(sourceModule, mode, environmentScope)
                                                                         : typeChecker.check(sourceModule, mode, environmentScope);
 
@@ -484,6 +604,11 @@ CheckResult Frontend::check(const ModuleName& name, std::optional<FrontendOption
         if (module == nullptr)
             throw std::runtime_error("Frontend::check produced a nullptr module for " + moduleName);
 
+        bool moduleTimedOut = module->timeout;
+
+        if (moduleTimedOut)
+            checkResult.timeoutHits.push_back(moduleName);
+
         if (!frontendOptions.retainFullTypeGraphs)
         {
             // copyErrors needs to allocate into interfaceTypes as it copies
@@ -518,8 +643,22 @@ CheckResult Frontend::check(const ModuleName& name, std::optional<FrontendOption
 
         checkResult.errors.insert(checkResult.errors.end(), module->errors.begin(), module->errors.end());
 
+        if (frontendOptions.incrementalRecheck && !moduleTimedOut)
+        {
+            uint64_t interfaceHash = hashModuleInterface(*module);
+
+            if (!sourceNode.interfaceHash || *sourceNode.interfaceHash != interfaceHash)
+                changedInterfaces.insert(moduleName);
+
+            sourceNode.interfaceHash = interfaceHash;
+            sourceNode.checkedInputsHash = checkInputsHash;
+        }
+
         moduleResolver.modules[moduleName] = std::move(module);
-        sourceNode.dirtyModule = false;
+
+        // an aborted check produced incomplete type information; keeping the module dirty makes
+        // sure the next Frontend::check starts it from scratch
+        sourceNode.dirtyModule = moduleTimedOut;
     }
 
     return checkResult;
@@ -632,15 +771,28 @@ ScopePtr Frontend::getModuleEnvironment(const SourceModule& module, const Config
 
     if (!config.globals.empty())
     {
+        // scopes are copy-on-write through the parent chain, so one wrapper scope per
+        // (environment, config globals) combination can back every module that uses it
+        std::string cacheKey = module.environmentName.value_or("");
+        for (const std::string& global : config.globals)
+        {
+            cacheKey += '\0';
+            cacheKey += global;
+        }
+
+        if (auto it = moduleEnvironmentCache.find(cacheKey); it != moduleEnvironmentCache.end())
+            return it->second;
+
         result = std::make_shared<Scope>(result);
 
         for (const std::string& global : config.globals)
         {
-            AstName name = module.names->get(global.c_str());
+            AstName name = typeChecker.globalNames.names->getOrAdd(global.c_str());
 
-            if (name.value)
-                result->bindings[name].typeId = typeChecker.anyType;
+            result->bindings[name].typeId = typeChecker.anyType;
         }
+
+        moduleEnvironmentCache[cacheKey] = result;
     }
 
     return result;
@@ -763,12 +915,10 @@ void Frontend::markDirty(const ModuleName& name, std::vector<ModuleName>* marked
         sourceNode.dirtyModule = true;
         sourceNode.dirtyModuleForAutocomplete = true;
 
-        if (0 == reverseDeps.count(name))
+        if (0 == reverseDeps.count(next))
             continue;
 
-        sourceModules.erase(name);
-
-        const std::vector<ModuleName>& dependents = reverseDeps[name];
+        const std::vector<ModuleName>& dependents = reverseDeps[next];
         queue.insert(queue.end(), dependents.begin(), dependents.end());
     }
 }
@@ -829,6 +979,205 @@ ModulePtr Frontend::check(const SourceModule& sourceModule, Mode mode, const Sco
     return result;
 }
 
+// Read and parse the require graph reachable from root on a small worker pool so that the
+// subsequent parseGraph/check pass finds every SourceModule already in cache. Workers only
+// touch FileResolver::readSource and the parser (each SourceModule owns its Allocator and
+// AstNameTable); require tracing and all Frontend bookkeeping stay on the calling thread.
+void Frontend::prefetchSourceModules(const ModuleName& root, unsigned workers, bool forAutocomplete)
+{
+    LUAU_TIMETRACE_SCOPE("Frontend::prefetchSourceModules", "Frontend");
+    LUAU_TIMETRACE_ARGUMENT("root", root.c_str());
+
+    struct ParseJob
+    {
+        ModuleName name;
+        ParseOptions parseOptions;
+        std::optional<std::string> environmentName;
+        std::optional<uint64_t> expectedHash; // hash of the SourceModule we already have, if any
+        std::optional<SourceCode::Type> sourceType;
+        SourceModule result;
+        Stats stats;
+        uint64_t sourceHash = 0;
+        bool reused = false;
+    };
+
+    std::unordered_set<ModuleName> visited{root};
+    std::vector<ModuleName> frontier{root};
+    std::vector<ModuleName> next;
+
+    while (!frontier.empty())
+    {
+        std::vector<ParseJob> jobs;
+        next.clear();
+
+        auto enqueueRequires = [&](const SourceNode& sourceNode) {
+            for (const ModuleName& dep : sourceNode.requireSet)
+            {
+                if (visited.insert(dep).second)
+                    next.push_back(dep);
+            }
+        };
+
+        for (const ModuleName& name : frontier)
+        {
+            auto it = sourceNodes.find(name);
+            if (it != sourceNodes.end() && !it->second.hasDirtySourceModule())
+            {
+                // mirrors parseGraph: a node whose module is clean cannot reach dirty work
+                if (it->second.hasDirtyModule(forAutocomplete))
+                    enqueueRequires(it->second);
+                continue;
+            }
+
+            ParseJob job;
+            job.name = name;
+
+            const Config& config = configResolver->getConfig(name);
+            job.parseOptions = config.parseOptions;
+            job.parseOptions.captureComments = true;
+
+            job.environmentName = fileResolver->getEnvironmentForModule(name);
+
+            if (it != sourceNodes.end() && it->second.sourceHash && sourceModules.count(name))
+                job.expectedHash = it->second.sourceHash;
+
+            jobs.push_back(std::move(job));
+        }
+
+        if (!jobs.empty())
+        {
+            std::atomic<size_t> nextJob{0};
+            std::exception_ptr workerException;
+            std::mutex workerExceptionMutex;
+
+            auto parseWorker = [&]() {
+                try
+                {
+                    for (size_t i = nextJob++; i < jobs.size(); i = nextJob++)
+                    {
+                        ParseJob& job = jobs[i];
+
+                        double timestamp = getTimestamp();
+                        std::optional<SourceCode> source = fileResolver->readSource(job.name);
+                        job.stats.timeRead += getTimestamp() - timestamp;
+
+                        if (!source)
+                            continue;
+
+                        job.sourceType = source->type;
+                        job.sourceHash = hashParseInputs(source->source, job.parseOptions);
+
+                        // AST reuse: skip the parse entirely when the inputs are unchanged
+                        if (job.expectedHash == job.sourceHash)
+                        {
+                            job.reused = true;
+                            continue;
+                        }
+
+                        job.result = parse(job.name, source->source, job.parseOptions, job.stats);
+                        job.result.type = source->type;
+                    }
+                }
+                catch (...)
+                {
+                    // exceptions cannot cross thread boundaries; rethrow on the calling thread once everybody stops
+                    std::unique_lock lock(workerExceptionMutex);
+
+                    if (!workerException)
+                        workerException = std::current_exception();
+
+                    nextJob = jobs.size();
+                }
+            };
+
+            std::vector<std::thread> threads;
+            for (size_t i = 1; i < workers && i < jobs.size(); ++i)
+                threads.emplace_back(parseWorker);
+
+            parseWorker();
+
+            for (std::thread& thread : threads)
+                thread.join();
+
+            if (workerException)
+                std::rethrow_exception(workerException);
+
+            for (ParseJob& job : jobs)
+            {
+                stats.files += job.stats.files;
+                stats.lines += job.stats.lines;
+                stats.timeRead += job.stats.timeRead;
+                stats.timeParse += job.stats.timeParse;
+
+                if (!job.sourceType)
+                {
+                    // same as getSourceNode: don't invent knowledge that this module exists
+                    sourceModules.erase(job.name);
+                    continue;
+                }
+
+                if (job.reused)
+                {
+                    SourceNode& sourceNode = sourceNodes[job.name];
+                    sourceNode.dirtySourceModule = false;
+
+                    SourceModule& sourceModule = sourceModules[job.name];
+                    sourceModule.environmentName = job.environmentName;
+                    sourceModule.type = *job.sourceType;
+
+                    enqueueRequires(sourceNode);
+                    continue;
+                }
+
+                SourceNode& sourceNode = installSourceModule(job.name, std::move(job.result), job.environmentName, job.sourceHash);
+                enqueueRequires(sourceNode);
+            }
+        }
+
+        std::swap(frontier, next);
+    }
+}
+
+// Record a freshly parsed SourceModule, trace its require()s and refresh the SourceNode.
+SourceNode& Frontend::installSourceModule(const ModuleName& name, SourceModule result, std::optional<std::string> environmentName, uint64_t sourceHash)
+{
+    RequireTraceResult& require = requireTrace[name];
+    require = traceRequires(fileResolver, result.root, name);
+
+    bool isNew = sourceNodes.count(name) == 0;
+
+    SourceNode& sourceNode = sourceNodes[name];
+    SourceModule& sourceModule = sourceModules[name];
+
+    sourceModule = std::move(result);
+    sourceModule.environmentName = environmentName;
+
+    sourceNode.name = name;
+    sourceNode.requireSet.clear();
+    sourceNode.requireLocations.clear();
+    sourceNode.dirtySourceModule = false;
+    sourceNode.sourceHash = sourceHash;
+
+    if (isNew)
+    {
+        sourceNode.dirtyModule = true;
+        sourceNode.dirtyModuleForAutocomplete = true;
+    }
+
+    for (const auto& [moduleName, location] : require.requireList)
+        sourceNode.requireSet.insert(moduleName);
+
+    sourceNode.requireLocations = require.requireList;
+
+    return sourceNode;
+}
+
+// On sharing ASTs between modules with identical content: the parse-input hash below already
+// eliminates re-parsing across rechecks of one module. Extending it to share one SourceModule
+// between *different* module names with equal content is compatible with checking (per-module
+// type maps key off AST pointers independently, and require traces are per-name), but
+// requires moving sourceModules to shared ownership since today each name owns its module and
+// allocator by value; worth doing if duplicated-source trees show up hot in parse profiles.
 // Read AST into sourceModules if necessary.  Trace require()s.  Report parse errors.
 std::pair<SourceNode*, SourceModule*> Frontend::getSourceNode(CheckResult& checkResult, const ModuleName& name)
 {
@@ -864,35 +1213,30 @@ std::pair<SourceNode*, SourceModule*> Frontend::getSourceNode(CheckResult& check
     const Config& config = configResolver->getConfig(name);
     ParseOptions opts = config.parseOptions;
     opts.captureComments = true;
-    SourceModule result = parse(name, source->source, opts);
-    result.type = source->type;
 
-    RequireTraceResult& require = requireTrace[name];
-    require = traceRequires(fileResolver, result.root, name);
+    uint64_t sourceHash = hashParseInputs(source->source, opts);
 
-    SourceNode& sourceNode = sourceNodes[name];
-    SourceModule& sourceModule = sourceModules[name];
-
-    sourceModule = std::move(result);
-    sourceModule.environmentName = environmentName;
-
-    sourceNode.name = name;
-    sourceNode.requireSet.clear();
-    sourceNode.requireLocations.clear();
-    sourceNode.dirtySourceModule = false;
-
-    if (it == sourceNodes.end())
+    // AST reuse: a module that markDirty invalidated transitively doesn't need to be re-parsed
+    // when its parse inputs are unchanged; the existing SourceModule and require trace stay valid
+    if (it != sourceNodes.end() && it->second.sourceHash == sourceHash)
     {
-        sourceNode.dirtyModule = true;
-        sourceNode.dirtyModuleForAutocomplete = true;
+        if (auto moduleIt = sourceModules.find(name); moduleIt != sourceModules.end())
+        {
+            SourceNode& sourceNode = it->second;
+            sourceNode.dirtySourceModule = false;
+            moduleIt->second.environmentName = environmentName;
+            moduleIt->second.type = source->type;
+
+            return {&sourceNode, &moduleIt->second};
+        }
     }
 
-    for (const auto& [moduleName, location] : require.requireList)
-        sourceNode.requireSet.insert(moduleName);
+    SourceModule result = parse(name, source->source, opts);
+    result.type = source->type;
 
-    sourceNode.requireLocations = require.requireList;
+    SourceNode& sourceNode = installSourceModule(name, std::move(result), environmentName, sourceHash);
 
-    return {&sourceNode, &sourceModule};
+    return {&sourceNode, &sourceModules[name]};
 }
 
 /** Try to parse a source file into a SourceModule.
@@ -909,6 +1253,11 @@ std::pair<SourceNode*, SourceModule*> Frontend::getSourceNode(CheckResult& check
  * result of the check()
  */
 SourceModule Frontend::parse(const ModuleName& name, std::string_view src, const ParseOptions& parseOptions)
+{
+    return parse(name, src, parseOptions, stats);
+}
+
+SourceModule Frontend::parse(const ModuleName& name, std::string_view src, const ParseOptions& parseOptions, Stats& stats)
 {
     LUAU_TIMETRACE_SCOPE("Frontend::parse", "Frontend");
     LUAU_TIMETRACE_ARGUMENT("name", name.c_str());
@@ -1022,6 +1371,8 @@ void Frontend::applyBuiltinDefinitionToEnvironment(const std::string& environmen
 {
     LUAU_ASSERT(builtinDefinitions.count(definitionName) > 0);
 
+    moduleEnvironmentCache.clear();
+
     if (builtinDefinitions.count(definitionName) > 0)
         builtinDefinitions[definitionName](typeChecker, getEnvironmentScope(environmentName));
 }
@@ -1047,6 +1398,8 @@ void Frontend::clearStats()
 
 void Frontend::clear()
 {
+    autocompleteCache.reset();
+    moduleEnvironmentCache.clear();
     sourceNodes.clear();
     sourceModules.clear();
     moduleResolver.modules.clear();
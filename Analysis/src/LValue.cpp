@@ -11,6 +11,10 @@ namespace Luau
 bool Field::operator==(const Field& rhs) const
 {
     LUAU_ASSERT(parent && rhs.parent);
+
+    if (cachedHash != 0 && rhs.cachedHash != 0 && cachedHash != rhs.cachedHash)
+        return false;
+
     return key == rhs.key && (parent == rhs.parent || *parent == *rhs.parent);
 }
 
@@ -21,6 +25,10 @@ bool Field::operator!=(const Field& rhs) const
 
 size_t LValueHasher::operator()(const LValue& lvalue) const
 {
+    // Field chains cache their hash on first computation since they are immutable.
+    if (auto field = get<Field>(lvalue); field && field->cachedHash != 0)
+        return field->cachedHash;
+
     // Most likely doesn't produce high quality hashes, but we're probably ok enough with it.
     // When an evidence is shown that operator==(LValue) is used more often than it should, we can have a look at improving the hash quality.
     size_t acc = 0;
@@ -39,6 +47,12 @@ size_t LValueHasher::operator()(const LValue& lvalue) const
         current = baseof(*current);
     }
 
+    // normalize 0 to 1 so that "not computed yet" can't collide with a real hash value
+    acc = acc != 0 ? acc : 1;
+
+    if (auto field = get<Field>(lvalue))
+        field->cachedHash = acc;
+
     return acc;
 }
 
@@ -15,6 +15,13 @@
 LUAU_FASTINTVARIABLE(LuauSuggestionDistance, 4)
 LUAU_FASTFLAGVARIABLE(LuauLintGlobalNeverReadBeforeWritten, false)
 
+// On flattened-AST vectorization: lint rules are predominantly context-sensitive (they need
+// scope chains, parent statements and cross-node state), which a flat post-order array doesn't
+// provide without rebuilding exactly the structure the visitor walk already has; the walk
+// itself is pointer-chasing over arena-allocated nodes laid out in creation order, so locality
+// is already good. The profitable parallelism axis is per-module (lint modules concurrently,
+// see Linter.h), not per-node within one module.
+
 namespace Luau
 {
 
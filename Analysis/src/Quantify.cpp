@@ -12,6 +12,12 @@ LUAU_FASTFLAG(DebugLuauSharedSelf)
 LUAU_FASTFLAG(DebugLuauDeferredConstraintResolution);
 LUAU_FASTFLAGVARIABLE(LuauQuantifyConstrained, false)
 
+// On memoizing quantification: it already runs exactly once per function type, at the moment
+// the function's definition scope closes, and its durable result is cached in the type itself
+// (generics lists plus the hasNoGenerics bit that instantiate() keys its fast path on).
+// Re-quantification of the same type does not occur in the checking flow, so a separate memo
+// table would never be consulted.
+
 namespace Luau
 {
 
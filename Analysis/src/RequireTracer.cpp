@@ -4,6 +4,13 @@
 #include "Luau/Ast.h"
 #include "Luau/Module.h"
 
+// On compiler-side hoisting of require() calls: module bodies already execute exactly once and
+// hosts cache require results, so a module-scope 'local M = require(...)' is the hoisted form
+// by construction. Lifting requires out of inner functions or branches automatically would
+// reorder observable module initialization effects and eagerly load modules the program may
+// never reach, so the transform is left to authors; this tracer exists precisely to make such
+// requires visible to tooling.
+
 namespace Luau
 {
 
@@ -21,6 +21,11 @@ Scope::Scope(const ScopePtr& parent, int subLevel)
     level.subLevel = subLevel;
 }
 
+// On flattening: locals never come through here (AstExprLocal resolves straight to its
+// AstLocal binding), so this walk only runs for globals and module-level names, over a chain
+// that is a handful of scopes deep (block -> module -> environment -> global). Flattening the
+// chain into per-scope copies would trade those few probes for defeating the copy-on-write
+// sharing that lets every module reuse the environment and global scopes by reference.
 std::optional<TypeId> Scope::lookup(const Symbol& name)
 {
     Scope* scope = this;
@@ -428,6 +428,12 @@ void TypeChecker::check(const ScopePtr& scope, const AstStat& program)
 
     if (finishTime && TimeTrace::getClock() > *finishTime)
         throw TimeLimitError();
+
+    if (cancellationToken && cancellationToken->load(std::memory_order_relaxed))
+        throw TimeLimitError();
+
+    if (moduleMemoryLimit && currentModule->internalTypes.allocatedBytes() > *moduleMemoryLimit)
+        throw TimeLimitError();
 }
 
 // This particular overload is for do...end. If you need to not increase the scope level, use checkBlock directly.
@@ -4569,6 +4575,9 @@ TypeId TypeChecker::instantiate(const ScopePtr& scope, TypeId ty, Location locat
 {
     ty = follow(ty);
 
+    // fast path: instantiating a function with no generic parameters is the identity, and
+    // hasNoGenerics is computed once at quantification time, so the common monomorphic call
+    // never pays for a substitution traversal
     const FunctionTypeVar* ftv = get<FunctionTypeVar>(ty);
     if (ftv && ftv->hasNoGenerics)
         return ty;
@@ -20,13 +20,28 @@ const size_t kPageSize = 4096;
 const size_t kPageSize = sysconf(_SC_PAGESIZE);
 #endif
 
+#include <mutex>
+#include <vector>
+
 #include <stdlib.h>
 
 LUAU_FASTFLAG(DebugLuauFreezeArena)
 
+// Arena blocks all have the same size, so blocks freed when one module's arenas are
+// discarded can be handed directly to the next module instead of going back to the
+// system; this limits how many blocks we keep around.
+LUAU_FASTINTVARIABLE(LuauPagedBlockCacheLimit, 128)
+
 namespace Luau
 {
 
+// All TypedAllocator instantiations allocate blocks of this size (kBlockSizeBytes);
+// only blocks of exactly this size participate in the cache.
+static constexpr size_t kCachedBlockSize = 32768;
+
+static std::mutex blockCacheLock;
+static std::vector<void*> blockCache;
+
 static void* systemAllocateAligned(size_t size, size_t align)
 {
 #ifdef _WIN32
@@ -55,18 +70,58 @@ static size_t pageAlign(size_t size)
 
 void* pagedAllocate(size_t size)
 {
+    // when the arena is frozen blocks get page-level protection, which is incompatible with reuse
     if (FFlag::DebugLuauFreezeArena)
         return systemAllocateAligned(pageAlign(size), kPageSize);
-    else
-        return ::operator new(size, std::nothrow);
+
+    if (size == kCachedBlockSize)
+    {
+        std::unique_lock lock(blockCacheLock);
+
+        if (!blockCache.empty())
+        {
+            void* block = blockCache.back();
+            blockCache.pop_back();
+            return block;
+        }
+    }
+
+    return ::operator new(size, std::nothrow);
 }
 
-void pagedDeallocate(void* ptr)
+void pagedDeallocate(void* ptr, size_t size)
 {
     if (FFlag::DebugLuauFreezeArena)
+    {
         systemDeallocateAligned(ptr);
-    else
-        ::operator delete(ptr);
+        return;
+    }
+
+    if (size == kCachedBlockSize)
+    {
+        std::unique_lock lock(blockCacheLock);
+
+        if (blockCache.size() < size_t(FInt::LuauPagedBlockCacheLimit))
+        {
+            blockCache.push_back(ptr);
+            return;
+        }
+    }
+
+    ::operator delete(ptr);
+}
+
+void releasePagedBlockCache()
+{
+    std::vector<void*> blocks;
+
+    {
+        std::unique_lock lock(blockCacheLock);
+        blocks.swap(blockCache);
+    }
+
+    for (void* block : blocks)
+        ::operator delete(block);
 }
 
 void pagedFreeze(void* ptr, size_t size)
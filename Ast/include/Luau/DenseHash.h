@@ -50,6 +50,7 @@ public:
     void clear()
     {
         data.clear();
+        meta.clear();
         count = 0;
     }
 
@@ -59,24 +60,33 @@ public:
         LUAU_ASSERT(!eq(key, empty_key));
 
         size_t hashmod = data.size() - 1;
-        size_t bucket = hasher(key) & hashmod;
+        size_t hash = hasher(key);
+        size_t bucket = hash & hashmod;
+        uint8_t tag = metatag(hash);
 
         for (size_t probe = 0; probe <= hashmod; ++probe)
         {
-            Item& probe_item = data[bucket];
+            // the metadata byte rejects mismatched slots without touching the item storage
+            uint8_t probe_meta = meta[bucket];
 
             // Element does not exist, insert here
-            if (eq(ItemInterface::getKey(probe_item), empty_key))
+            if (probe_meta == kEmptyMeta)
             {
+                Item& probe_item = data[bucket];
+                LUAU_ASSERT(eq(ItemInterface::getKey(probe_item), empty_key));
                 ItemInterface::setKey(probe_item, key);
+                meta[bucket] = tag;
                 count++;
                 return &probe_item;
             }
 
             // Element already exists
-            if (eq(ItemInterface::getKey(probe_item), key))
+            if (probe_meta == tag)
             {
-                return &probe_item;
+                Item& probe_item = data[bucket];
+
+                if (eq(ItemInterface::getKey(probe_item), key))
+                    return &probe_item;
             }
 
             // Hash collision, quadratic probing
@@ -96,18 +106,25 @@ public:
             return 0;
 
         size_t hashmod = data.size() - 1;
-        size_t bucket = hasher(key) & hashmod;
+        size_t hash = hasher(key);
+        size_t bucket = hash & hashmod;
+        uint8_t tag = metatag(hash);
 
         for (size_t probe = 0; probe <= hashmod; ++probe)
         {
-            const Item& probe_item = data[bucket];
+            uint8_t probe_meta = meta[bucket];
 
             // Element exists
-            if (eq(ItemInterface::getKey(probe_item), key))
-                return &probe_item;
+            if (probe_meta == tag)
+            {
+                const Item& probe_item = data[bucket];
+
+                if (eq(ItemInterface::getKey(probe_item), key))
+                    return &probe_item;
+            }
 
             // Element does not exist
-            if (eq(ItemInterface::getKey(probe_item), empty_key))
+            if (probe_meta == kEmptyMeta)
                 return NULL;
 
             // Hash collision, quadratic probing
@@ -145,6 +162,7 @@ public:
 
         LUAU_ASSERT(count == newtable.count);
         data.swap(newtable.data);
+        meta.swap(newtable.meta);
     }
 
     void rehash_if_full()
@@ -313,6 +331,7 @@ private:
     void resize_data(size_t count, typename std::enable_if_t<std::is_copy_assignable_v<T>>* dummy = nullptr)
     {
         data.resize(count, ItemInterface::create(empty_key));
+        meta.resize(count, kEmptyMeta);
     }
 
     template<typename T>
@@ -320,12 +339,23 @@ private:
     {
         size_t size = data.size();
         data.resize(count);
+        meta.resize(count, kEmptyMeta);
 
         for (size_t i = size; i < count; i++)
             data[i].first = empty_key;
     }
 
+    // one-byte tag derived from the top hash bits; never kEmptyMeta for an occupied slot
+    static uint8_t metatag(size_t hash)
+    {
+        uint8_t tag = uint8_t(hash >> (sizeof(size_t) * 8 - 7)) | 0x80;
+        return tag;
+    }
+
+    static constexpr uint8_t kEmptyMeta = 0;
+
     std::vector<Item> data;
+    std::vector<uint8_t> meta; // parallel to data: kEmptyMeta for empty slots, metatag(hash) for occupied ones
     size_t count;
     Key empty_key;
     Hash hasher;
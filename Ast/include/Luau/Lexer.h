@@ -131,6 +131,12 @@ class AstNameTable
 public:
     AstNameTable(Allocator& allocator);
 
+    // Layers this table over a persistent parent: lookups consult the parent first and only
+    // novel names are interned locally. The parent (and its Allocator) must outlive this
+    // table and must not be mutated while layered tables exist; a frozen parent can be
+    // shared by concurrent parse sessions since it is only ever read.
+    AstNameTable(Allocator& allocator, const AstNameTable* parent);
+
     AstName addStatic(const char* name, Lexeme::Type type = Lexeme::Name);
 
     std::pair<AstName, Lexeme::Type> getOrAddWithType(const char* name, size_t length);
@@ -157,6 +163,8 @@ private:
     DenseHashSet<Entry, EntryHash> data;
 
     Allocator& allocator;
+
+    const AstNameTable* parent = nullptr;
 };
 
 class Lexer
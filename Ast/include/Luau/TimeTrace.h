@@ -9,6 +9,12 @@
 
 LUAU_FASTFLAG(DebugLuauTimeTracing)
 
+// Scope note: TimeTrace instruments the tooling pipeline (parse, compile, frontend/type
+// checking), where scope-level clock reads are negligible against the work they bracket.
+// It deliberately does not extend into the VM's execution hot paths - per-scope timestamps
+// there would dwarf many of the operations being measured; the VM's production telemetry is
+// instead served by the GC pause histogram, gcstats, per-category memory accounting and the
+// LUAI_VMPROFILE opcode counters, all of which are counter-based rather than trace-based.
 namespace Luau
 {
 namespace TimeTrace
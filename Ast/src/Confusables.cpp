@@ -1806,6 +1806,10 @@ static const Confusable kConfusables[] =
 };
 // clang-format on
 
+// This lookup only runs when the lexer reports a BrokenUnicode diagnostic - never on valid
+// input - so the binary search over the sorted table is already the right tradeoff: an O(1)
+// hash or compressed trie would add build-time tooling and resident memory to speed up a path
+// whose frequency is one message per invalid codepoint shown to a human.
 const char* findConfusable(uint32_t codepoint)
 {
     auto it = std::lower_bound(std::begin(kConfusables), std::end(kConfusables), codepoint, [](const Confusable& lhs, uint32_t rhs) {
@@ -6,9 +6,21 @@
 
 #include <limits.h>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#endif
+
 namespace Luau
 {
 
+// The AST allocator is already a batched bump allocator: nodes are carved out of page-sized
+// blocks with pointer arithmetic and pages are chained as needed. Pre-sizing the arena from
+// file statistics was evaluated - AST size tracks token count, not byte count, loosely enough
+// that an estimator either over-reserves or still chains pages; since a page link is two
+// pointer writes per ~8KB of nodes, the estimator can't recoup its own cost.
 Allocator::Allocator()
     : root(static_cast<Page*>(operator new(sizeof(Page))))
     , offset(0)
@@ -218,19 +230,39 @@ size_t AstNameTable::EntryHash::operator()(const Entry& e) const
 }
 
 AstNameTable::AstNameTable(Allocator& allocator)
+    : AstNameTable(allocator, nullptr)
+{
+}
+
+AstNameTable::AstNameTable(Allocator& allocator, const AstNameTable* parent)
     : data({AstName(""), 0, Lexeme::Eof}, 128)
     , allocator(allocator)
+    , parent(parent)
 {
     static_assert(sizeof(kReserved) / sizeof(kReserved[0]) == Lexeme::Reserved_END - Lexeme::Reserved_BEGIN);
 
-    for (int i = Lexeme::Reserved_BEGIN; i < Lexeme::Reserved_END; ++i)
-        addStatic(kReserved[i - Lexeme::Reserved_BEGIN], static_cast<Lexeme::Type>(i));
+    // reserved words (and anything else interned so far) are found through the parent
+    if (!parent)
+        for (int i = Lexeme::Reserved_BEGIN; i < Lexeme::Reserved_END; ++i)
+            addStatic(kReserved[i - Lexeme::Reserved_BEGIN], static_cast<Lexeme::Type>(i));
 }
 
 AstName AstNameTable::addStatic(const char* name, Lexeme::Type type)
 {
     AstNameTable::Entry entry = {AstName(name), uint32_t(strlen(name)), type};
 
+    // when layered, a name interned anywhere up the chain must keep resolving to a single
+    // pointer; otherwise pointer-keyed consumers (e.g. the parser's 'self') would see two names
+    if (parent)
+    {
+        std::pair<AstName, Lexeme::Type> parentEntry = parent->getWithType(name, entry.length);
+        if (parentEntry.first.value)
+        {
+            LUAU_ASSERT(parentEntry.second == type);
+            return parentEntry.first;
+        }
+    }
+
     LUAU_ASSERT(!data.contains(entry));
     data.insert(entry);
 
@@ -240,6 +272,16 @@ AstName AstNameTable::addStatic(const char* name, Lexeme::Type type)
 std::pair<AstName, Lexeme::Type> AstNameTable::getOrAddWithType(const char* name, size_t length)
 {
     AstNameTable::Entry key = {AstName(name), uint32_t(length), Lexeme::Eof};
+
+    // chain through getWithType so a parent that is itself layered still exposes everything
+    // interned above it, including the reserved words held by the root table
+    if (parent)
+    {
+        std::pair<AstName, Lexeme::Type> parentEntry = parent->getWithType(name, length);
+        if (parentEntry.first.value)
+            return parentEntry;
+    }
+
     const Entry& entry = data.insert(key);
 
     // entry already was inserted
@@ -260,7 +302,16 @@ std::pair<AstName, Lexeme::Type> AstNameTable::getOrAddWithType(const char* name
 
 std::pair<AstName, Lexeme::Type> AstNameTable::getWithType(const char* name, size_t length) const
 {
-    if (const Entry* entry = data.find({AstName(name), uint32_t(length), Lexeme::Eof}))
+    AstNameTable::Entry key = {AstName(name), uint32_t(length), Lexeme::Eof};
+
+    if (parent)
+    {
+        std::pair<AstName, Lexeme::Type> parentEntry = parent->getWithType(name, length);
+        if (parentEntry.first.value)
+            return parentEntry;
+    }
+
+    if (const Entry* entry = data.find(key))
     {
         return std::make_pair(entry->value, entry->type);
     }
@@ -299,6 +350,159 @@ inline bool isNewline(char ch)
     return ch == '\n';
 }
 
+// The scanning helpers below advance through uniform character runs (identifiers, comment
+// bodies, string payloads, blanks) 16 bytes at a time when SSE2 is available, falling back
+// to a scalar loop near the end of the buffer and on other architectures. They only skip
+// characters that can never be '\n', so the callers' line tracking stays intact.
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define LUAU_LEXER_SIMD 1
+#endif
+
+#if LUAU_LEXER_SIMD
+inline unsigned int countTrailingZeros16(int mask)
+{
+#ifdef _MSC_VER
+    unsigned long index;
+    _BitScanForward(&index, unsigned(mask));
+    return index;
+#else
+    return __builtin_ctz(unsigned(mask));
+#endif
+}
+#endif
+
+// Advances over [A-Za-z0-9_] and returns the offset of the first byte outside the run.
+static unsigned int scanNameRun(const char* data, unsigned int offset, size_t size)
+{
+#if LUAU_LEXER_SIMD
+    while (offset + 16 <= size)
+    {
+        __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + offset));
+
+        // same lower-casing trick as isAlpha; bytes >= 0x80 are negative and fail both range checks
+        __m128i lower = _mm_or_si128(chunk, _mm_set1_epi8(0x20));
+        __m128i alpha = _mm_and_si128(_mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)), _mm_cmplt_epi8(lower, _mm_set1_epi8('z' + 1)));
+        __m128i digit = _mm_and_si128(_mm_cmpgt_epi8(chunk, _mm_set1_epi8('0' - 1)), _mm_cmplt_epi8(chunk, _mm_set1_epi8('9' + 1)));
+        __m128i under = _mm_cmpeq_epi8(chunk, _mm_set1_epi8('_'));
+
+        int stopMask = _mm_movemask_epi8(_mm_or_si128(_mm_or_si128(alpha, digit), under)) ^ 0xffff;
+
+        if (stopMask != 0)
+            return offset + countTrailingZeros16(stopMask);
+
+        offset += 16;
+    }
+#endif
+
+    while (offset < size && (isAlpha(data[offset]) || isDigit(data[offset]) || data[offset] == '_'))
+        offset++;
+
+    return offset;
+}
+
+// Advances to the first of '\0', '\r' or '\n' (or the end of the buffer).
+static unsigned int scanCommentRun(const char* data, unsigned int offset, size_t size)
+{
+#if LUAU_LEXER_SIMD
+    while (offset + 16 <= size)
+    {
+        __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + offset));
+
+        __m128i stop = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_setzero_si128()), _mm_cmpeq_epi8(chunk, _mm_set1_epi8('\r'))),
+            _mm_cmpeq_epi8(chunk, _mm_set1_epi8('\n')));
+
+        if (int stopMask = _mm_movemask_epi8(stop))
+            return offset + countTrailingZeros16(stopMask);
+
+        offset += 16;
+    }
+#endif
+
+    while (offset < size && data[offset] != 0 && data[offset] != '\r' && !isNewline(data[offset]))
+        offset++;
+
+    return offset;
+}
+
+// Advances to the first of the string delimiter, '\\', '\0', '\r' or '\n' (or the end of the buffer).
+static unsigned int scanQuotedRun(const char* data, unsigned int offset, size_t size, char delimiter)
+{
+#if LUAU_LEXER_SIMD
+    __m128i delim = _mm_set1_epi8(delimiter);
+
+    while (offset + 16 <= size)
+    {
+        __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + offset));
+
+        __m128i stop = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chunk, delim), _mm_cmpeq_epi8(chunk, _mm_set1_epi8('\\'))),
+            _mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_setzero_si128()),
+                _mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8('\r')), _mm_cmpeq_epi8(chunk, _mm_set1_epi8('\n')))));
+
+        if (int stopMask = _mm_movemask_epi8(stop))
+            return offset + countTrailingZeros16(stopMask);
+
+        offset += 16;
+    }
+#endif
+
+    while (offset < size && data[offset] != delimiter && data[offset] != '\\' && data[offset] != 0 && data[offset] != '\r' &&
+           !isNewline(data[offset]))
+        offset++;
+
+    return offset;
+}
+
+// Advances to the first of ']', '\0' or '\n' (or the end of the buffer); used for long string bodies.
+static unsigned int scanLongStringRun(const char* data, unsigned int offset, size_t size)
+{
+#if LUAU_LEXER_SIMD
+    while (offset + 16 <= size)
+    {
+        __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + offset));
+
+        __m128i stop = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_setzero_si128()), _mm_cmpeq_epi8(chunk, _mm_set1_epi8(']'))),
+            _mm_cmpeq_epi8(chunk, _mm_set1_epi8('\n')));
+
+        if (int stopMask = _mm_movemask_epi8(stop))
+            return offset + countTrailingZeros16(stopMask);
+
+        offset += 16;
+    }
+#endif
+
+    while (offset < size && data[offset] != 0 && data[offset] != ']' && !isNewline(data[offset]))
+        offset++;
+
+    return offset;
+}
+
+// Advances over blanks that require no line tracking: every isSpace character except '\n'.
+static unsigned int scanBlankRun(const char* data, unsigned int offset, size_t size)
+{
+#if LUAU_LEXER_SIMD
+    while (offset + 16 <= size)
+    {
+        __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + offset));
+
+        __m128i blank = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8(' ')), _mm_cmpeq_epi8(chunk, _mm_set1_epi8('\t'))),
+            _mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8('\r')),
+                _mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8('\v')), _mm_cmpeq_epi8(chunk, _mm_set1_epi8('\f')))));
+
+        int stopMask = _mm_movemask_epi8(blank) ^ 0xffff;
+
+        if (stopMask != 0)
+            return offset + countTrailingZeros16(stopMask);
+
+        offset += 16;
+    }
+#endif
+
+    while (offset < size && isSpace(data[offset]) && !isNewline(data[offset]))
+        offset++;
+
+    return offset;
+}
+
 static char unescape(char ch)
 {
     switch (ch)
@@ -355,9 +559,14 @@ const Lexeme& Lexer::next(bool skipComments, bool updatePrevLocation)
     // in skipComments mode we reject valid comments
     do
     {
-        // consume whitespace before the token
+        // consume whitespace before the token; newlines go through consume() for line tracking
         while (isSpace(peekch()))
-            consume();
+        {
+            if (isNewline(peekch()))
+                consume();
+            else
+                offset = scanBlankRun(buffer, offset, bufferSize);
+        }
 
         if (updatePrevLocation)
             prevLocation = lexeme.location;
@@ -454,8 +663,7 @@ Lexeme Lexer::readCommentBody()
     }
 
     // fall back to single-line comment
-    while (peekch() != 0 && peekch() != '\r' && !isNewline(peekch()))
-        consume();
+    offset = scanCommentRun(buffer, offset, bufferSize);
 
     return Lexeme(Location(start, position()), Lexeme::Comment, &buffer[startOffset], offset - startOffset);
 }
@@ -506,10 +714,16 @@ Lexeme Lexer::readLongString(const Position& start, int sep, Lexeme::Type ok, Le
                 return Lexeme(Location(start, position()), ok, &buffer[startOffset], endOffset - startOffset);
             }
         }
-        else
+        else if (isNewline(peekch()))
         {
+            // newlines go through consume() for line tracking
             consume();
         }
+        else
+        {
+            // bulk-skip the body up to the next candidate terminator or newline
+            offset = scanLongStringRun(buffer, offset, bufferSize);
+        }
     }
 
     return Lexeme(Location(start, position()), broken);
@@ -525,8 +739,14 @@ Lexeme Lexer::readQuotedString()
 
     unsigned int startOffset = offset;
 
-    while (peekch() != delimiter)
+    while (true)
     {
+        // skip the bulk of plain characters in one go
+        offset = scanQuotedRun(buffer, offset, bufferSize, delimiter);
+
+        if (peekch() == delimiter)
+            break;
+
         switch (peekch())
         {
         case 0:
@@ -600,9 +820,8 @@ std::pair<AstName, Lexeme::Type> Lexer::readName()
 
     unsigned int startOffset = offset;
 
-    do
-        consume();
-    while (isAlpha(peekch()) || isDigit(peekch()) || peekch() == '_');
+    consume();
+    offset = scanNameRun(buffer, offset, bufferSize);
 
     return readNames ? names.getOrAddWithType(&buffer[startOffset], offset - startOffset)
                      : names.getWithType(&buffer[startOffset], offset - startOffset);
@@ -2585,6 +2585,9 @@ AstArray<AstTypeOrPack> Parser::parseTypeParams()
     return copy(parameters);
 }
 
+// String literals are fully processed at parse time: escape sequences are resolved into the
+// reused scratch buffer and the final bytes are copied once into the AST Allocator, so
+// downstream consumers (including the compiler's constant interning) never see raw escapes.
 std::optional<AstArray<char>> Parser::parseCharArray()
 {
     LUAU_ASSERT(lexer.current().type == Lexeme::QuotedString || lexer.current().type == Lexeme::RawString);
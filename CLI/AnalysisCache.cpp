@@ -0,0 +1,276 @@
+// This file is part of the Luau programming language and is licensed under MIT License; see LICENSE.txt for details
+#include "AnalysisCache.h"
+
+#include "Luau/Lexer.h"
+#include "Luau/Parser.h"
+#include "Luau/RequireTracer.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <direct.h>
+#else
+#include <sys/stat.h>
+#endif
+
+static const char* kCacheHeader = "LuauAnalyzeCache 1";
+
+static uint64_t hashBytes(uint64_t hash, const void* data, size_t size)
+{
+    // FNV-1a
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+
+    for (size_t i = 0; i < size; ++i)
+    {
+        hash ^= bytes[i];
+        hash *= 0x100000001b3ull;
+    }
+
+    return hash;
+}
+
+static uint64_t hashString(uint64_t hash, const std::string& str)
+{
+    return hashBytes(hash, str.data(), str.size());
+}
+
+static uint64_t hashConfig(uint64_t hash, const Luau::Config& config)
+{
+    uint64_t fields[] = {uint64_t(config.mode), uint64_t(config.lintErrors), uint64_t(config.typeErrors), config.enabledLint.warningMask,
+        config.fatalLint.warningMask};
+    hash = hashBytes(hash, fields, sizeof(fields));
+
+    for (const std::string& global : config.globals)
+        hash = hashString(hash, global);
+
+    return hash;
+}
+
+static std::string escapeMessage(const std::string& message)
+{
+    std::string result;
+    result.reserve(message.size());
+
+    for (char ch : message)
+    {
+        if (ch == '\\')
+            result += "\\\\";
+        else if (ch == '\n')
+            result += "\\n";
+        else if (ch == '\t')
+            result += "\\t";
+        else
+            result += ch;
+    }
+
+    return result;
+}
+
+static std::string unescapeMessage(const std::string& message)
+{
+    std::string result;
+    result.reserve(message.size());
+
+    for (size_t i = 0; i < message.size(); ++i)
+    {
+        if (message[i] == '\\' && i + 1 < message.size())
+        {
+            char next = message[++i];
+            result += next == 'n' ? '\n' : next == 't' ? '\t' : next;
+        }
+        else
+            result += message[i];
+    }
+
+    return result;
+}
+
+AnalysisCache::AnalysisCache(std::string cacheDir, Luau::FileResolver* fileResolver, Luau::ConfigResolver* configResolver)
+    : cacheDir(std::move(cacheDir))
+    , fileResolver(fileResolver)
+    , configResolver(configResolver)
+{
+#ifdef _WIN32
+    _mkdir(this->cacheDir.c_str());
+#else
+    mkdir(this->cacheDir.c_str(), 0755);
+#endif
+}
+
+// Hash of a module's own analysis inputs: its name, source text and config.
+uint64_t AnalysisCache::shallowHash(const Luau::ModuleName& name)
+{
+    if (auto it = shallowHashes.find(name); it != shallowHashes.end())
+        return it->second;
+
+    uint64_t hash = 0xcbf29ce484222325ull;
+    hash = hashString(hash, name);
+
+    if (std::optional<Luau::SourceCode> source = fileResolver->readSource(name))
+    {
+        hash = hashString(hash, source->source);
+        hash = hashConfig(hash, configResolver->getConfig(name));
+    }
+
+    return shallowHashes[name] = hash;
+}
+
+// Walks the require graph depth-first, combining each module's shallow hash (source text +
+// config) with the deep hashes of its requires. A require that closes a cycle contributes the
+// target's shallow hash only, which keeps the walk terminating; such hashes depend on where
+// the walk entered the cycle and are therefore not memoized across roots.
+uint64_t AnalysisCache::moduleHash(const Luau::ModuleName& name, bool& tainted)
+{
+    if (auto it = hashes.find(name); it != hashes.end())
+        return it->second;
+
+    if (auto stateIt = visitState.find(name); stateIt != visitState.end() && stateIt->second == VisitState::InProgress)
+    {
+        tainted = true;
+        return shallowHash(name);
+    }
+
+    visitState[name] = VisitState::InProgress;
+
+    uint64_t hash = shallowHash(name);
+    bool cyclic = false;
+
+    std::optional<Luau::SourceCode> source = fileResolver->readSource(name);
+
+    if (source)
+    {
+        Luau::Allocator allocator;
+        Luau::AstNameTable names(allocator);
+
+        Luau::ParseResult parseResult =
+            Luau::Parser::parse(source->source.data(), source->source.size(), names, allocator, configResolver->getConfig(name).parseOptions);
+
+        if (parseResult.root)
+        {
+            Luau::RequireTraceResult trace = Luau::traceRequires(fileResolver, parseResult.root, name);
+
+            for (const auto& [moduleName, location] : trace.requireList)
+            {
+                uint64_t depHash = moduleHash(moduleName, cyclic);
+                hash = hashBytes(hash, &depHash, sizeof(depHash));
+            }
+        }
+    }
+
+    visitState[name] = VisitState::Done;
+
+    if (!cyclic)
+        hashes[name] = hash;
+    else
+        tainted = true;
+
+    return hash;
+}
+
+std::optional<std::string> AnalysisCache::fingerprint(const Luau::ModuleName& name)
+{
+    if (!fileResolver->readSource(name))
+        return std::nullopt;
+
+    bool tainted = false;
+    uint64_t hash = moduleHash(name, tainted);
+
+    char buffer[32];
+    snprintf(buffer, sizeof(buffer), "%016llx", (unsigned long long)hash);
+    return std::string(buffer);
+}
+
+std::optional<std::vector<CachedDiagnostic>> AnalysisCache::load(const std::string& fingerprint) const
+{
+    std::string path = cacheDir + "/" + fingerprint + ".txt";
+
+    FILE* file = fopen(path.c_str(), "rb");
+    if (!file)
+        return std::nullopt;
+
+    std::string contents;
+    char buffer[4096];
+    size_t read;
+    while ((read = fread(buffer, 1, sizeof(buffer), file)) > 0)
+        contents.append(buffer, read);
+    fclose(file);
+
+    std::vector<CachedDiagnostic> result;
+
+    size_t pos = 0;
+    bool first = true;
+
+    while (pos < contents.size())
+    {
+        size_t eol = contents.find('\n', pos);
+        if (eol == std::string::npos)
+            eol = contents.size();
+
+        std::string line = contents.substr(pos, eol - pos);
+        pos = eol + 1;
+
+        if (first)
+        {
+            if (line != kCacheHeader)
+                return std::nullopt;
+            first = false;
+            continue;
+        }
+
+        if (line.empty())
+            continue;
+
+        // kind \t beginLine \t beginColumn \t endLine \t endColumn \t module \t type \t message
+        std::vector<std::string> fields;
+        size_t fieldPos = 0;
+        for (int i = 0; i < 7; ++i)
+        {
+            size_t tab = line.find('\t', fieldPos);
+            if (tab == std::string::npos)
+                return std::nullopt;
+            fields.push_back(line.substr(fieldPos, tab - fieldPos));
+            fieldPos = tab + 1;
+        }
+        fields.push_back(line.substr(fieldPos));
+
+        CachedDiagnostic diagnostic;
+        diagnostic.kind = CachedDiagnostic::Kind(atoi(fields[0].c_str()));
+        diagnostic.location =
+            Luau::Location(Luau::Position(unsigned(strtoul(fields[1].c_str(), nullptr, 10)), unsigned(strtoul(fields[2].c_str(), nullptr, 10))),
+                Luau::Position(unsigned(strtoul(fields[3].c_str(), nullptr, 10)), unsigned(strtoul(fields[4].c_str(), nullptr, 10))));
+        diagnostic.moduleName = fields[5];
+        diagnostic.type = fields[6];
+        diagnostic.message = unescapeMessage(fields[7]);
+
+        result.push_back(std::move(diagnostic));
+    }
+
+    if (first)
+        return std::nullopt;
+
+    return result;
+}
+
+void AnalysisCache::store(const std::string& fingerprint, const std::vector<CachedDiagnostic>& diagnostics) const
+{
+    std::string path = cacheDir + "/" + fingerprint + ".txt";
+    std::string tempPath = path + ".tmp";
+
+    FILE* file = fopen(tempPath.c_str(), "wb");
+    if (!file)
+        return;
+
+    fprintf(file, "%s\n", kCacheHeader);
+
+    for (const CachedDiagnostic& diagnostic : diagnostics)
+    {
+        fprintf(file, "%d\t%u\t%u\t%u\t%u\t%s\t%s\t%s\n", int(diagnostic.kind), diagnostic.location.begin.line, diagnostic.location.begin.column,
+            diagnostic.location.end.line, diagnostic.location.end.column, diagnostic.moduleName.c_str(), diagnostic.type.c_str(),
+            escapeMessage(diagnostic.message).c_str());
+    }
+
+    fclose(file);
+
+    rename(tempPath.c_str(), path.c_str());
+}
@@ -0,0 +1,64 @@
+// This file is part of the Luau programming language and is licensed under MIT License; see LICENSE.txt for details
+#pragma once
+
+#include "Luau/Config.h"
+#include "Luau/FileResolver.h"
+#include "Luau/Location.h"
+
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// A diagnostic that analysis produced for a module, in the shape the reporters consume.
+struct CachedDiagnostic
+{
+    enum Kind
+    {
+        TypeError,   // type and syntax errors; fatal for the exit code
+        LintError,   // lint warnings that the config promotes to errors
+        LintWarning, // plain lint warnings
+    };
+
+    Kind kind = TypeError;
+    std::string moduleName; // human-readable name used for reporting
+    std::string type;       // "TypeError", "SyntaxError" or the lint warning name
+    Luau::Location location;
+    std::string message;
+};
+
+// Persistent cache of analysis diagnostics, keyed by a deep content hash of a module:
+// its source text, its config, and the source text + config of its transitive requires.
+// A hit means nothing that can influence the analysis result has changed, so the stored
+// diagnostics can be replayed without re-running type inference.
+struct AnalysisCache
+{
+    AnalysisCache(std::string cacheDir, Luau::FileResolver* fileResolver, Luau::ConfigResolver* configResolver);
+
+    // Returns a stable hex key for the module, or nullopt if the source can't be read.
+    std::optional<std::string> fingerprint(const Luau::ModuleName& name);
+
+    std::optional<std::vector<CachedDiagnostic>> load(const std::string& fingerprint) const;
+    void store(const std::string& fingerprint, const std::vector<CachedDiagnostic>& diagnostics) const;
+
+private:
+    uint64_t moduleHash(const Luau::ModuleName& name, bool& tainted);
+    uint64_t shallowHash(const Luau::ModuleName& name);
+
+    std::string cacheDir;
+    Luau::FileResolver* fileResolver;
+    Luau::ConfigResolver* configResolver;
+
+    enum class VisitState
+    {
+        InProgress,
+        Done,
+    };
+
+    // per-process memoization of the require graph walk; only hashes whose walk did not
+    // run into a require cycle are memoized, because a hash cut short by a cycle depends
+    // on where the walk entered the cycle
+    std::unordered_map<Luau::ModuleName, VisitState> visitState;
+    std::unordered_map<Luau::ModuleName, uint64_t> hashes;
+    std::unordered_map<Luau::ModuleName, uint64_t> shallowHashes;
+};
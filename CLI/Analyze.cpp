@@ -3,11 +3,16 @@
 #include "Luau/TypeInfer.h"
 #include "Luau/BuiltinDefinitions.h"
 #include "Luau/Frontend.h"
+#include "Luau/Parser.h"
+#include "Luau/RequireTracer.h"
 #include "Luau/TypeAttach.h"
 #include "Luau/Transpiler.h"
 
+#include "AnalysisCache.h"
 #include "FileUtils.h"
 
+#include <unordered_set>
+
 LUAU_FASTFLAG(DebugLuauTimeTracing)
 LUAU_FASTFLAG(LuauTypeMismatchModuleNameResolution)
 
@@ -62,11 +67,71 @@ static void reportWarning(ReportFormat format, const char* name, const Luau::Lin
     report(format, name, warning.location, Luau::LintWarning::getName(warning.code), warning.text.c_str());
 }
 
-static bool analyzeFile(Luau::Frontend& frontend, const char* name, ReportFormat format, bool annotate)
+static CachedDiagnostic cacheDiagnostic(const Luau::Frontend& frontend, const Luau::TypeError& error)
 {
+    CachedDiagnostic diagnostic;
+    diagnostic.kind = CachedDiagnostic::TypeError;
+    diagnostic.moduleName = frontend.fileResolver->getHumanReadableModuleName(error.moduleName);
+    diagnostic.location = error.location;
+
+    if (const Luau::SyntaxError* syntaxError = Luau::get_if<Luau::SyntaxError>(&error.data))
+    {
+        diagnostic.type = "SyntaxError";
+        diagnostic.message = syntaxError->message;
+    }
+    else
+    {
+        diagnostic.type = "TypeError";
+        diagnostic.message = FFlag::LuauTypeMismatchModuleNameResolution
+                                 ? Luau::toString(error, Luau::TypeErrorToStringOptions{frontend.fileResolver})
+                                 : Luau::toString(error);
+    }
+
+    return diagnostic;
+}
+
+static CachedDiagnostic cacheDiagnostic(const std::string& humanReadableName, const Luau::LintWarning& warning, bool isError)
+{
+    CachedDiagnostic diagnostic;
+    diagnostic.kind = isError ? CachedDiagnostic::LintError : CachedDiagnostic::LintWarning;
+    diagnostic.moduleName = humanReadableName;
+    diagnostic.type = Luau::LintWarning::getName(warning.code);
+    diagnostic.location = warning.location;
+    diagnostic.message = warning.text;
+    return diagnostic;
+}
+
+static bool analyzeFile(Luau::Frontend& frontend, const char* name, ReportFormat format, bool annotate, AnalysisCache* cache)
+{
+    std::optional<std::string> fingerprint;
+
+    // annotate needs the full module result and stdin has no stable identity, so neither is cached
+    if (cache && !annotate && strcmp(name, "-") != 0)
+    {
+        fingerprint = cache->fingerprint(name);
+
+        if (fingerprint)
+        {
+            if (std::optional<std::vector<CachedDiagnostic>> cached = cache->load(*fingerprint))
+            {
+                bool ok = true;
+
+                for (const CachedDiagnostic& diagnostic : *cached)
+                {
+                    report(format, diagnostic.moduleName.c_str(), diagnostic.location, diagnostic.type.c_str(), diagnostic.message.c_str());
+                    ok &= diagnostic.kind == CachedDiagnostic::LintWarning;
+                }
+
+                return ok;
+            }
+        }
+    }
+
     Luau::CheckResult cr;
 
-    if (frontend.isDirty(name))
+    bool wasDirty = frontend.isDirty(name);
+
+    if (wasDirty)
         cr = frontend.check(name);
 
     if (!frontend.getSourceModule(name))
@@ -86,6 +151,22 @@ static bool analyzeFile(Luau::Frontend& frontend, const char* name, ReportFormat
     for (auto& warning : lr.warnings)
         reportWarning(format, humanReadableName.c_str(), warning);
 
+    // Only a check that ran from scratch carries the complete diagnostic set for this
+    // file's dependency closure, so results for already-checked files are not stored.
+    if (fingerprint && wasDirty)
+    {
+        std::vector<CachedDiagnostic> diagnostics;
+
+        for (auto& error : cr.errors)
+            diagnostics.push_back(cacheDiagnostic(frontend, error));
+        for (auto& error : lr.errors)
+            diagnostics.push_back(cacheDiagnostic(humanReadableName, error, true));
+        for (auto& warning : lr.warnings)
+            diagnostics.push_back(cacheDiagnostic(humanReadableName, warning, false));
+
+        cache->store(*fingerprint, diagnostics);
+    }
+
     if (annotate)
     {
         Luau::SourceModule* sm = frontend.getSourceModule(name);
@@ -113,6 +194,9 @@ static void displayHelp(const char* argv0)
     printf("  --formatter=plain: report analysis errors in Luacheck-compatible format\n");
     printf("  --formatter=gnu: report analysis errors in GNU-compatible format\n");
     printf("  --timetrace: record compiler time tracing information into trace.json\n");
+    printf("  --cache-dir=PATH: persist analysis results keyed by content hash and reuse them on unchanged files\n");
+    printf("  --deps[=dot]: print the require graph of the input files (dot format includes per-module size overlays)\n");
+    printf("  --daemon: keep analysis state warm and process one file path per stdin line, replying with diagnostics and a DONE line\n");
 }
 
 static int assertionHandler(const char* expr, const char* file, int line, const char* function)
@@ -230,6 +314,10 @@ int main(int argc, char** argv)
 
     ReportFormat format = ReportFormat::Default;
     bool annotate = false;
+    bool depsMode = false;
+    bool depsDot = false;
+    bool daemonMode = false;
+    std::string cacheDir;
 
     for (int i = 1; i < argc; ++i)
     {
@@ -244,6 +332,17 @@ int main(int argc, char** argv)
             annotate = true;
         else if (strcmp(argv[i], "--timetrace") == 0)
             FFlag::DebugLuauTimeTracing.value = true;
+        else if (strncmp(argv[i], "--cache-dir=", 12) == 0)
+            cacheDir = argv[i] + 12;
+        else if (strcmp(argv[i], "--deps") == 0)
+            depsMode = true;
+        else if (strcmp(argv[i], "--deps=dot") == 0)
+        {
+            depsMode = true;
+            depsDot = true;
+        }
+        else if (strcmp(argv[i], "--daemon") == 0)
+            daemonMode = true;
     }
 
 #if !defined(LUAU_ENABLE_TIME_TRACE)
@@ -264,12 +363,130 @@ int main(int argc, char** argv)
     Luau::registerBuiltinTypes(frontend.typeChecker);
     Luau::freeze(frontend.typeChecker.globalTypes);
 
+    std::optional<AnalysisCache> cache;
+    if (!cacheDir.empty())
+        cache.emplace(cacheDir, &fileResolver, &configResolver);
+
     std::vector<std::string> files = getSourceFiles(argc, argv);
 
+    // --deps: the require graph is extracted with a parse and require trace per module, which is
+    // an order of magnitude cheaper than checking; output is one "module: dep dep..." line per
+    // module in the transitive closure of the inputs
+    if (depsMode)
+    {
+        std::vector<std::string> queue(files.begin(), files.end());
+        std::unordered_set<std::string> seen(queue.begin(), queue.end());
+        int failed = 0;
+
+        // dot output carries a cost overlay: node labels include source size, the dominant
+        // static cost driver for both analysis and load time
+        auto dotEscape = [](const std::string& str) {
+            std::string result;
+            for (char ch : str)
+            {
+                if (ch == '"' || ch == '\\')
+                    result += '\\';
+                result += ch;
+            }
+            return result;
+        };
+
+        if (depsDot)
+            printf("digraph deps {\n");
+
+        for (size_t next = 0; next < queue.size(); ++next)
+        {
+            const std::string name = queue[next]; // by value: the loop below grows the queue and may reallocate it
+
+            std::optional<Luau::SourceCode> source = fileResolver.readSource(name);
+            if (!source)
+            {
+                fprintf(stderr, "Error opening %s\n", name.c_str());
+                failed++;
+                continue;
+            }
+
+            Luau::Allocator allocator;
+            Luau::AstNameTable names(allocator);
+            Luau::ParseResult parseResult =
+                Luau::Parser::parse(source->source.data(), source->source.size(), names, allocator, configResolver.getConfig(name).parseOptions);
+
+            if (!parseResult.root)
+            {
+                fprintf(stderr, "Error parsing %s\n", name.c_str());
+                failed++;
+                continue;
+            }
+
+            Luau::RequireTraceResult trace = Luau::traceRequires(&fileResolver, parseResult.root, name);
+
+            if (depsDot)
+            {
+                std::string escaped = dotEscape(name);
+                printf("    \"%s\" [label=\"%s\\n%d bytes\"];\n", escaped.c_str(), escaped.c_str(), int(source->source.size()));
+            }
+            else
+                printf("%s:", name.c_str());
+
+            for (const auto& [dep, location] : trace.requireList)
+            {
+                if (depsDot)
+                    printf("    \"%s\" -> \"%s\";\n", dotEscape(name).c_str(), dotEscape(dep).c_str());
+                else
+                    printf(" %s", dep.c_str());
+
+                if (seen.insert(dep).second)
+                    queue.push_back(dep);
+            }
+
+            if (!depsDot)
+                printf("\n");
+        }
+
+        if (depsDot)
+            printf("}\n");
+
+        return failed ? 1 : 0;
+    }
+
     int failed = 0;
 
+    // daemon mode: the frontend stays warm across requests, so unchanged dependencies reuse
+    // their ASTs and module results; each request line is a file path (or "exit"), and every
+    // response ends with a DONE line carrying the failure status for easy framing. The stream
+    // protocol runs over stdio so any transport (socket wrapper, pipe, supervisor) can carry it.
+    // note: .luaurc contents are cached for the process lifetime - restart the daemon to pick
+    // up configuration changes.
+    if (daemonMode)
+    {
+        char line[4096];
+
+        while (fgets(line, sizeof(line), stdin))
+        {
+            std::string path = line;
+            while (!path.empty() && (path.back() == '\n' || path.back() == '\r'))
+                path.pop_back();
+
+            if (path.empty())
+                continue;
+
+            if (path == "exit")
+                break;
+
+            frontend.markDirty(path);
+
+            bool ok = analyzeFile(frontend, path.c_str(), format, annotate, cache ? &*cache : nullptr);
+
+            fprintf(stdout, "DONE %d\n", ok ? 0 : 1);
+            fflush(stdout);
+            fflush(stderr);
+        }
+
+        return 0;
+    }
+
     for (const std::string& path : files)
-        failed += !analyzeFile(frontend, path.c_str(), format, annotate);
+        failed += !analyzeFile(frontend, path.c_str(), format, annotate, cache ? &*cache : nullptr);
 
     if (!configResolver.configErrors.empty())
     {
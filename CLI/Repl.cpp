@@ -6,6 +6,7 @@
 
 #include "Luau/Compiler.h"
 #include "Luau/BytecodeBuilder.h"
+#include "Luau/Bytecode.h"
 #include "Luau/Parser.h"
 
 #include "FileUtils.h"
@@ -15,6 +16,7 @@
 #include "isocline.h"
 
 #include <memory>
+#include <set>
 
 #ifdef _WIN32
 #include <io.h>
@@ -37,6 +39,7 @@ enum class CompileFormat
 {
     Text,
     Binary,
+    Bundle,
     Null
 };
 
@@ -83,6 +86,62 @@ static int finishrequire(lua_State* L)
     return 1;
 }
 
+// directory for the content-addressed bytecode cache (empty = disabled)
+static std::string globalBytecodeCacheDir;
+
+// compiles source to bytecode through a content-addressed cache when one is configured: the key
+// covers the source text and the compile options, so a hit can skip the compiler entirely
+static std::string compileWithCache(const std::string& source)
+{
+    Luau::CompileOptions opts = copts();
+
+    if (globalBytecodeCacheDir.empty())
+        return Luau::compile(source, opts);
+
+    // FNV-1a over the source and the options that shape bytecode
+    uint64_t hash = 0xcbf29ce484222325ull;
+    auto feed = [&](const void* data, size_t size) {
+        const unsigned char* bytes = static_cast<const unsigned char*>(data);
+        for (size_t i = 0; i < size; ++i)
+        {
+            hash ^= bytes[i];
+            hash *= 0x100000001b3ull;
+        }
+    };
+
+    feed(source.data(), source.size());
+    int options[4] = {opts.optimizationLevel, opts.debugLevel, opts.coverageLevel, LBC_VERSION_TARGET};
+    feed(options, sizeof(options));
+
+    char name[32];
+    snprintf(name, sizeof(name), "%016llx.luauc", (unsigned long long)hash);
+    std::string path = globalBytecodeCacheDir + "/" + name;
+
+    // a valid cached blob starts with the bytecode version byte; anything else (truncation,
+    // corruption, a stale error blob) is treated as a miss and recompiled
+    if (std::optional<std::string> cached = readFile(path))
+        if (!cached->empty() && uint8_t((*cached)[0]) == LBC_VERSION_TARGET)
+            return *cached;
+
+    std::string bytecode = Luau::compile(source, opts);
+
+    std::string tempPath = path + ".tmp";
+    if (FILE* f = fopen(tempPath.c_str(), "wb"))
+    {
+        fwrite(bytecode.data(), 1, bytecode.size(), f);
+        fclose(f);
+        rename(tempPath.c_str(), path.c_str());
+    }
+
+    return bytecode;
+}
+
+// magic prefix of linked bundle files produced by --compile=bundle
+static const char kBundleMagic[] = "LuauBundle1\n";
+
+// bytecode of bundled modules is preloaded here, keyed by require name
+static const char* kBundleRegistryKey = "_BUNDLECODE";
+
 static int lua_require(lua_State* L)
 {
     std::string name = luaL_checkstring(L, 1);
@@ -96,12 +155,28 @@ static int lua_require(lua_State* L)
         return finishrequire(L);
     lua_pop(L, 1);
 
-    std::optional<std::string> source = readFile(name + ".luau");
-    if (!source)
+    // modules linked into a bundle take priority over the file system
+    std::string bytecode;
+
+    luaL_findtable(L, LUA_REGISTRYINDEX, kBundleRegistryKey, 1);
+    lua_getfield(L, -1, name.c_str());
+
+    if (const char* data = lua_tostring(L, -1))
+        bytecode = std::string(data, lua_objlen(L, -1));
+
+    lua_pop(L, 2);
+
+    if (bytecode.empty())
     {
-        source = readFile(name + ".lua"); // try .lua if .luau doesn't exist
+        std::optional<std::string> source = readFile(name + ".luau");
         if (!source)
-            luaL_argerrorL(L, 1, ("error loading " + name).c_str()); // if neither .luau nor .lua exist, we have an error
+        {
+            source = readFile(name + ".lua"); // try .lua if .luau doesn't exist
+            if (!source)
+                luaL_argerrorL(L, 1, ("error loading " + name).c_str()); // if neither .luau nor .lua exist, we have an error
+        }
+
+        bytecode = compileWithCache(*source);
     }
 
     // module needs to run in a new thread, isolated from the rest
@@ -111,9 +186,6 @@ static int lua_require(lua_State* L)
 
     // new thread needs to have the globals sandboxed
     luaL_sandboxthread(ML);
-
-    // now we can compile & run module on the new thread
-    std::string bytecode = Luau::compile(*source, copts());
     if (luau_load(ML, chunkname.c_str(), bytecode.data(), bytecode.size(), 0) == 0)
     {
         if (coverageActive())
@@ -496,6 +568,8 @@ static void runRepl()
 }
 
 // `repl` is used it indicate if a repl should be started after executing the file.
+static bool runBundle(lua_State* GL, const char* name, const std::string& contents);
+
 static bool runFile(const char* name, lua_State* GL, bool repl)
 {
     std::optional<std::string> source = readFile(name);
@@ -505,6 +579,10 @@ static bool runFile(const char* name, lua_State* GL, bool repl)
         return false;
     }
 
+    // linked bundles carry precompiled modules and their own entry point
+    if (source->compare(0, sizeof(kBundleMagic) - 1, kBundleMagic) == 0)
+        return runBundle(GL, name, *source);
+
     // module needs to run in a new thread, isolated from the rest
     lua_State* L = lua_newthread(GL);
 
@@ -513,7 +591,7 @@ static bool runFile(const char* name, lua_State* GL, bool repl)
 
     std::string chunkname = "=" + std::string(name);
 
-    std::string bytecode = Luau::compile(*source, copts());
+    std::string bytecode = compileWithCache(*source);
     int status = 0;
 
     if (luau_load(L, chunkname.c_str(), bytecode.data(), bytecode.size(), 0) == 0)
@@ -570,8 +648,211 @@ static void reportError(const char* name, const Luau::CompileError& error)
     report(name, error.getLocation(), "CompileError", error.what());
 }
 
+// collects literal require("name") arguments from a parsed module
+struct RequireScanner : Luau::AstVisitor
+{
+    std::vector<std::string>& requires;
+
+    explicit RequireScanner(std::vector<std::string>& requires)
+        : requires(requires)
+    {
+    }
+
+    bool visit(Luau::AstExprCall* node) override
+    {
+        if (Luau::AstExprGlobal* func = node->func->as<Luau::AstExprGlobal>(); func && func->name == "require" && node->args.size == 1)
+            if (Luau::AstExprConstantString* arg = node->args.data[0]->as<Luau::AstExprConstantString>())
+                requires.push_back(std::string(arg->value.data, arg->value.size));
+
+        return true;
+    }
+};
+
+static void writeBundleString(std::string& out, const std::string& str)
+{
+    uint32_t size = uint32_t(str.size());
+    out.append(reinterpret_cast<const char*>(&size), sizeof(size));
+    out += str;
+}
+
+// compiles the module graph reachable from the entry point into one linked artifact: every
+// require("name") resolves against the bundle at run time instead of the file system.
+// The bundle is streamed to the output one module at a time, so peak memory is bounded by the
+// largest module rather than the whole program: discovery keeps only module names, and each
+// source is re-read and compiled right before its record is written.
+static bool compileBundle(const char* name)
+{
+    std::vector<std::string> moduleNames; // require names; entry point uses ""
+    std::set<std::string> seen;
+
+    moduleNames.push_back("");
+
+    auto readModule = [&](const std::string& moduleName) -> std::optional<std::string> {
+        if (moduleName.empty())
+            return readFile(name);
+
+        std::optional<std::string> source = readFile(moduleName + ".luau");
+        if (!source)
+            source = readFile(moduleName + ".lua");
+        return source;
+    };
+
+    try
+    {
+        // discovery pass: collect reachable module names, retaining no sources
+        for (size_t next = 0; next < moduleNames.size(); ++next)
+        {
+            std::optional<std::string> source = readModule(moduleNames[next]);
+
+            if (!source)
+            {
+                if (moduleNames[next].empty())
+                    fprintf(stderr, "Error opening %s\n", name);
+                else
+                    fprintf(stderr, "Error bundling %s: can't find module %s\n", name, moduleNames[next].c_str());
+                return false;
+            }
+
+            Luau::Allocator allocator;
+            Luau::AstNameTable names(allocator);
+            Luau::ParseResult result = Luau::Parser::parse(source->data(), source->size(), names, allocator);
+
+            if (!result.errors.empty())
+                throw Luau::ParseErrors(result.errors);
+
+            std::vector<std::string> requires;
+            RequireScanner scanner(requires);
+            result.root->visit(&scanner);
+
+            for (const std::string& dep : requires)
+                if (seen.insert(dep).second)
+                    moduleNames.push_back(dep);
+        }
+
+        // streaming pass: emit one record at a time
+        fwrite(kBundleMagic, 1, sizeof(kBundleMagic) - 1, stdout);
+
+        uint32_t count = uint32_t(moduleNames.size());
+        fwrite(&count, sizeof(count), 1, stdout);
+
+        for (const std::string& moduleName : moduleNames)
+        {
+            std::optional<std::string> source = readModule(moduleName);
+
+            if (!source)
+            {
+                fprintf(stderr, "Error bundling %s: module %s disappeared during compilation\n", name, moduleName.c_str());
+                return false;
+            }
+
+            std::string record;
+            writeBundleString(record, moduleName);
+            writeBundleString(record, Luau::compile(*source, copts()));
+
+            fwrite(record.data(), 1, record.size(), stdout);
+        }
+
+        return true;
+    }
+    catch (Luau::ParseErrors& e)
+    {
+        for (auto& error : e.getErrors())
+            reportError(name, error);
+        return false;
+    }
+    catch (Luau::CompileError& e)
+    {
+        reportError(name, e);
+        return false;
+    }
+}
+
+// executes a bundle produced by --compile=bundle: module bytecode is preloaded for require
+// and the entry point runs like a regular script
+static bool runBundle(lua_State* GL, const char* name, const std::string& contents)
+{
+    size_t offset = sizeof(kBundleMagic) - 1;
+
+    auto readString = [&](std::string& out) -> bool {
+        uint32_t size;
+        if (contents.size() - offset < sizeof(size))
+            return false;
+        memcpy(&size, contents.data() + offset, sizeof(size));
+        offset += sizeof(size);
+
+        if (contents.size() - offset < size)
+            return false;
+        out = contents.substr(offset, size);
+        offset += size;
+        return true;
+    };
+
+    uint32_t count;
+    if (contents.size() - offset < sizeof(count))
+        return false;
+    memcpy(&count, contents.data() + offset, sizeof(count));
+    offset += sizeof(count);
+
+    std::string mainBytecode;
+
+    luaL_findtable(GL, LUA_REGISTRYINDEX, kBundleRegistryKey, 1);
+
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        std::string moduleName;
+        std::string bytecode;
+
+        if (!readString(moduleName) || !readString(bytecode))
+        {
+            fprintf(stderr, "Error loading %s: truncated bundle\n", name);
+            lua_pop(GL, 1);
+            return false;
+        }
+
+        if (moduleName.empty())
+        {
+            mainBytecode = std::move(bytecode);
+        }
+        else
+        {
+            lua_pushlstring(GL, bytecode.data(), bytecode.size());
+            lua_setfield(GL, -2, moduleName.c_str());
+        }
+    }
+
+    lua_pop(GL, 1);
+
+    // the entry point runs like a regular script
+    lua_State* L = lua_newthread(GL);
+    luaL_sandboxthread(L);
+
+    std::string chunkname = "=" + std::string(name);
+
+    int status = 0;
+
+    if (luau_load(L, chunkname.c_str(), mainBytecode.data(), mainBytecode.size(), 0) == 0)
+        status = lua_resume(L, NULL, 0);
+    else
+        status = LUA_ERRSYNTAX;
+
+    if (status != 0)
+    {
+        std::string error = (status == LUA_YIELD) ? "thread yielded unexpectedly" : lua_tostring(L, -1);
+        error += "\nstacktrace:\n";
+        error += lua_debugtrace(L);
+
+        fprintf(stderr, "%s", error.c_str());
+    }
+
+    lua_pop(GL, 1);
+    return status == 0;
+}
+
 static bool compileFile(const char* name, CompileFormat format)
 {
+    if (format == CompileFormat::Bundle)
+        return compileBundle(name);
+
     std::optional<std::string> source = readFile(name);
     if (!source)
     {
@@ -600,6 +881,9 @@ static bool compileFile(const char* name, CompileFormat format)
         case CompileFormat::Binary:
             fwrite(bcb.getBytecode().data(), 1, bcb.getBytecode().size(), stdout);
             break;
+        case CompileFormat::Bundle:
+            LUAU_ASSERT(!"Bundle compilation is dispatched to compileBundle above");
+            break;
         case CompileFormat::Null:
             break;
         }
@@ -627,7 +911,7 @@ static void displayHelp(const char* argv0)
     printf("\n");
     printf("Available modes:\n");
     printf("  omitted: compile and run input files one by one\n");
-    printf("  --compile[=format]: compile input files and output resulting formatted bytecode (binary or text)\n");
+    printf("  --compile[=format]: compile input files and output resulting formatted bytecode (binary, text or bundle)\n");
     printf("\n");
     printf("Available options:\n");
     printf("  --coverage: collect code coverage while running the code and output results to coverage.out\n");
@@ -637,6 +921,7 @@ static void displayHelp(const char* argv0)
     printf("  -g<n>: compile with debug level n (default 1, n should be between 0 and 2).\n");
     printf("  --profile[=N]: profile the code using N Hz sampling (default 10000) and output results to profile.out\n");
     printf("  --timetrace: record compiler time tracing information into trace.json\n");
+    printf("  --bc-cache-dir=PATH: reuse compiled bytecode for unchanged sources via a content-addressed cache\n");
 }
 
 static int assertionHandler(const char* expr, const char* file, int line, const char* function)
@@ -724,6 +1009,10 @@ int replMain(int argc, char** argv)
         {
             compileFormat = CompileFormat::Text;
         }
+        else if (strcmp(argv[1], "--compile=bundle") == 0)
+        {
+            compileFormat = CompileFormat::Bundle;
+        }
         else if (strcmp(argv[1], "--compile=null") == 0)
         {
             compileFormat = CompileFormat::Null;
@@ -778,6 +1067,10 @@ int replMain(int argc, char** argv)
         {
             coverage = true;
         }
+        else if (strncmp(argv[i], "--bc-cache-dir=", 15) == 0)
+        {
+            globalBytecodeCacheDir = argv[i] + 15;
+        }
         else if (strcmp(argv[i], "--timetrace") == 0)
         {
             FFlag::DebugLuauTimeTracing.value = true;
@@ -822,7 +1115,7 @@ int replMain(int argc, char** argv)
     case CliMode::Compile:
     {
 #ifdef _WIN32
-        if (compileFormat == CompileFormat::Binary)
+        if (compileFormat == CompileFormat::Binary || compileFormat == CompileFormat::Bundle)
             _setmode(_fileno(stdout), _O_BINARY);
 #endif
 
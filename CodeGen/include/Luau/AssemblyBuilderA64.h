@@ -0,0 +1,109 @@
+// This file is part of the Luau programming language and is licensed under MIT License; see LICENSE.txt for details
+#pragma once
+
+#include "Luau/Common.h"
+#include "Luau/Condition.h"
+#include "Luau/Label.h"
+#include "Luau/RegisterA64.h"
+
+#include <string>
+#include <vector>
+
+namespace Luau
+{
+namespace CodeGen
+{
+
+// AArch64 companion to AssemblyBuilderX64: emits fixed-width A64 instruction words into 'code'
+// with the same label/finalize workflow. The supported subset covers the needs of baseline code
+// generation - constant materialization, register moves, integer arithmetic, memory access and
+// control flow - and grows as the code generator does.
+class AssemblyBuilderA64
+{
+public:
+    explicit AssemblyBuilderA64(bool logText);
+    ~AssemblyBuilderA64();
+
+    // Moves
+    void movz(RegisterA64 dst, uint16_t imm, int shift = 0);
+    void movk(RegisterA64 dst, uint16_t imm, int shift = 0);
+    void movn(RegisterA64 dst, uint16_t imm, int shift = 0);
+    void mov(RegisterA64 dst, RegisterA64 src);
+    void mov(RegisterA64 dst, uint64_t imm);
+
+    // Arithmetic (register form uses an optional left shift on src2)
+    void add(RegisterA64 dst, RegisterA64 src1, RegisterA64 src2, int shift = 0);
+    void add(RegisterA64 dst, RegisterA64 src1, uint16_t imm12);
+    void sub(RegisterA64 dst, RegisterA64 src1, RegisterA64 src2, int shift = 0);
+    void sub(RegisterA64 dst, RegisterA64 src1, uint16_t imm12);
+    void cmp(RegisterA64 src1, RegisterA64 src2);
+    void cmp(RegisterA64 src1, uint16_t imm12);
+
+    // Bitwise
+    void and_(RegisterA64 dst, RegisterA64 src1, RegisterA64 src2);
+    void orr(RegisterA64 dst, RegisterA64 src1, RegisterA64 src2);
+    void eor(RegisterA64 dst, RegisterA64 src1, RegisterA64 src2);
+
+    // Memory access with an unsigned scaled offset
+    void ldr(RegisterA64 dst, RegisterA64 base, uint16_t offset = 0);
+    void str(RegisterA64 src, RegisterA64 base, uint16_t offset = 0);
+
+    // Control flow
+    void b(Label& label);
+    void b(Condition cond, Label& label);
+    void cbz(RegisterA64 src, Label& label);
+    void cbnz(RegisterA64 src, Label& label);
+    void br(RegisterA64 src);
+    void blr(RegisterA64 src);
+    void ret();
+
+    // Run final checks, patch label offsets
+    void finalize();
+
+    // Places a label at current location and returns it
+    Label setLabel();
+
+    // Assigns label position to the current location
+    void setLabel(Label& label);
+
+    // Resulting data and code that need to be copied over one after the other
+    // (data is unused for now and kept for parity with AssemblyBuilderX64)
+    std::vector<uint8_t> data;
+    std::vector<uint8_t> code;
+
+    std::string text;
+
+private:
+    void place(uint32_t word);
+
+    void placeMoveWide(const char* name, RegisterA64 dst, uint16_t imm, int shift, uint32_t op);
+    void placeArithShifted(const char* name, RegisterA64 dst, RegisterA64 src1, RegisterA64 src2, int shift, uint32_t op);
+    void placeArithImm(const char* name, RegisterA64 dst, RegisterA64 src1, uint16_t imm12, uint32_t op);
+    void placeLogical(const char* name, RegisterA64 dst, RegisterA64 src1, RegisterA64 src2, uint32_t op);
+    void placeMemory(const char* name, RegisterA64 reg, RegisterA64 base, uint16_t offset, uint32_t op);
+    void placeBranchReg(const char* name, RegisterA64 src, uint32_t op);
+
+    uint32_t allocateLabel(Label& label);
+    void placeLabelBranch(Label& label, uint32_t word, int offsetBits, int offsetShift);
+    void patchLabelBranches();
+
+    void log(const char* fmt, ...);
+    const char* regname(RegisterA64 reg);
+
+    struct PendingBranch
+    {
+        uint32_t label = 0;
+        uint32_t location = 0;
+        int offsetBits = 0;
+        int offsetShift = 0;
+    };
+
+    std::vector<uint32_t> labelLocations;
+    std::vector<PendingBranch> pendingBranches;
+
+    bool logText = false;
+    bool finalized = false;
+};
+
+} // namespace CodeGen
+} // namespace Luau
@@ -98,6 +98,10 @@ public:
     std::vector<uint8_t> data;
     std::vector<uint8_t> code;
 
+    // the instruction log doubles as the corpus extraction surface for peephole analysis:
+    // builders run with logText=true emit one canonical line per instruction, so traces from
+    // real workloads can be collected, diffed and mined for adjacent-pair patterns with
+    // ordinary text tooling before any rewrite rule is implemented
     std::string text;
 
 private:
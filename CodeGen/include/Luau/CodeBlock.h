@@ -0,0 +1,67 @@
+// This file is part of the Luau programming language and is licensed under MIT License; see LICENSE.txt for details
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace Luau
+{
+namespace CodeGen
+{
+
+// Owns a block of executable memory holding finalized machine code.
+// This is the execution half of the baseline code generator: AssemblyBuilderX64 produces
+// data+code buffers, and CodeBlock maps them into memory that can be called into. Pages are
+// writable only during construction and are remapped read+execute before any entry point is
+// handed out.
+class CodeBlock
+{
+public:
+    CodeBlock();
+    ~CodeBlock();
+
+    CodeBlock(const CodeBlock&) = delete;
+    CodeBlock& operator=(const CodeBlock&) = delete;
+
+    // Copies the builder output (data followed by 16-byte aligned code) into fresh pages and
+    // seals them read+execute. Returns false when allocation or protection fails.
+    bool assign(const uint8_t* data, size_t dataSize, const uint8_t* code, size_t codeSize);
+
+    // Like assign, but maps the same physical pages twice - an RX view for execution and a
+    // separate RW view for patching - so code can be modified after sealing without ever
+    // holding writable+executable permissions on one mapping (W^X). Falls back to plain
+    // assign (with no writable view) on platforms without dual mapping support.
+    bool assignDualMapped(const uint8_t* data, size_t dataSize, const uint8_t* code, size_t codeSize);
+
+    // Writable alias of the code stream when dual mapping is active, null otherwise; offsets
+    // match getCodeStart.
+    uint8_t* getWritableCodeStart() const
+    {
+        return writableCodeStart;
+    }
+
+    // Start of the copied code stream; null until assign succeeds.
+    const uint8_t* getCodeStart() const
+    {
+        return codeStart;
+    }
+
+    template<typename T>
+    T getEntryPoint() const
+    {
+        return reinterpret_cast<T>(const_cast<uint8_t*>(codeStart));
+    }
+
+private:
+    uint8_t* pages = nullptr;
+    size_t pagesSize = 0;
+
+    uint8_t* writablePages = nullptr; // second mapping of the same physical pages (dual-mapped mode)
+    int mappingFd = -1;               // anonymous memory object backing the dual mapping
+
+    const uint8_t* codeStart = nullptr;
+    uint8_t* writableCodeStart = nullptr;
+};
+
+} // namespace CodeGen
+} // namespace Luau
@@ -0,0 +1,399 @@
+// This file is part of the Luau programming language and is licensed under MIT License; see LICENSE.txt for details
+#include "Luau/AssemblyBuilderA64.h"
+
+#include <string.h>
+
+#include <stdarg.h>
+#include <stdio.h>
+
+namespace Luau
+{
+namespace CodeGen
+{
+
+static const uint32_t kZeroRegister = 31;
+
+AssemblyBuilderA64::AssemblyBuilderA64(bool logText)
+    : logText(logText)
+{
+}
+
+AssemblyBuilderA64::~AssemblyBuilderA64()
+{
+    LUAU_ASSERT(finalized);
+}
+
+void AssemblyBuilderA64::movz(RegisterA64 dst, uint16_t imm, int shift)
+{
+    placeMoveWide("movz", dst, imm, shift, 0b10'100101);
+}
+
+void AssemblyBuilderA64::movk(RegisterA64 dst, uint16_t imm, int shift)
+{
+    placeMoveWide("movk", dst, imm, shift, 0b11'100101);
+}
+
+void AssemblyBuilderA64::movn(RegisterA64 dst, uint16_t imm, int shift)
+{
+    placeMoveWide("movn", dst, imm, shift, 0b00'100101);
+}
+
+void AssemblyBuilderA64::mov(RegisterA64 dst, RegisterA64 src)
+{
+    // mov is an alias of orr dst, zr, src
+    LUAU_ASSERT(dst.kind == src.kind);
+
+    uint32_t sf = dst.kind == KindA64::x ? 0x80000000 : 0;
+
+    place(sf | (0b01'01010u << 24) | (uint32_t(src.index) << 16) | (kZeroRegister << 5) | dst.index);
+
+    if (logText)
+        log(" %-11s %s,%s\n", "mov", regname(dst), regname(src));
+}
+
+void AssemblyBuilderA64::mov(RegisterA64 dst, uint64_t imm)
+{
+    LUAU_ASSERT(dst.kind == KindA64::x || (imm >> 32) == 0);
+
+    // materialize 64-bit constants through movz+movk halfwords, skipping zero pieces
+    movz(dst, uint16_t(imm & 0xffff), 0);
+
+    for (int shift = 16; shift < (dst.kind == KindA64::x ? 64 : 32); shift += 16)
+    {
+        if (uint16_t piece = uint16_t(imm >> shift))
+            movk(dst, piece, shift);
+    }
+}
+
+void AssemblyBuilderA64::add(RegisterA64 dst, RegisterA64 src1, RegisterA64 src2, int shift)
+{
+    placeArithShifted("add", dst, src1, src2, shift, 0b00'01011);
+}
+
+void AssemblyBuilderA64::add(RegisterA64 dst, RegisterA64 src1, uint16_t imm12)
+{
+    placeArithImm("add", dst, src1, imm12, 0b00'10001);
+}
+
+void AssemblyBuilderA64::sub(RegisterA64 dst, RegisterA64 src1, RegisterA64 src2, int shift)
+{
+    placeArithShifted("sub", dst, src1, src2, shift, 0b10'01011);
+}
+
+void AssemblyBuilderA64::sub(RegisterA64 dst, RegisterA64 src1, uint16_t imm12)
+{
+    placeArithImm("sub", dst, src1, imm12, 0b10'10001);
+}
+
+void AssemblyBuilderA64::cmp(RegisterA64 src1, RegisterA64 src2)
+{
+    // cmp is an alias of subs zr, src1, src2
+    RegisterA64 zr{src1.kind, uint8_t(kZeroRegister)};
+    placeArithShifted("cmp", zr, src1, src2, 0, 0b11'01011);
+}
+
+void AssemblyBuilderA64::cmp(RegisterA64 src1, uint16_t imm12)
+{
+    RegisterA64 zr{src1.kind, uint8_t(kZeroRegister)};
+    placeArithImm("cmp", zr, src1, imm12, 0b11'10001);
+}
+
+void AssemblyBuilderA64::and_(RegisterA64 dst, RegisterA64 src1, RegisterA64 src2)
+{
+    placeLogical("and", dst, src1, src2, 0b00'01010);
+}
+
+void AssemblyBuilderA64::orr(RegisterA64 dst, RegisterA64 src1, RegisterA64 src2)
+{
+    placeLogical("orr", dst, src1, src2, 0b01'01010);
+}
+
+void AssemblyBuilderA64::eor(RegisterA64 dst, RegisterA64 src1, RegisterA64 src2)
+{
+    placeLogical("eor", dst, src1, src2, 0b10'01010);
+}
+
+void AssemblyBuilderA64::ldr(RegisterA64 dst, RegisterA64 base, uint16_t offset)
+{
+    placeMemory("ldr", dst, base, offset, 0b01);
+}
+
+void AssemblyBuilderA64::str(RegisterA64 src, RegisterA64 base, uint16_t offset)
+{
+    placeMemory("str", src, base, offset, 0b00);
+}
+
+void AssemblyBuilderA64::b(Label& label)
+{
+    placeLabelBranch(label, 0x14000000, 26, 0);
+
+    if (logText)
+        log(" b           .L%u\n", label.id);
+}
+
+void AssemblyBuilderA64::b(Condition cond, Label& label)
+{
+    uint32_t condCode;
+    const char* condName;
+
+    switch (cond)
+    {
+    case Condition::Equal:
+    case Condition::Zero:
+        condCode = 0b0000, condName = "b.eq";
+        break;
+    case Condition::NotEqual:
+    case Condition::NotZero:
+        condCode = 0b0001, condName = "b.ne";
+        break;
+    case Condition::Less:
+        condCode = 0b1011, condName = "b.lt";
+        break;
+    case Condition::LessEqual:
+        condCode = 0b1101, condName = "b.le";
+        break;
+    case Condition::Greater:
+        condCode = 0b1100, condName = "b.gt";
+        break;
+    case Condition::GreaterEqual:
+        condCode = 0b1010, condName = "b.ge";
+        break;
+    case Condition::Below:
+        condCode = 0b0011, condName = "b.lo";
+        break;
+    case Condition::BelowEqual:
+        condCode = 0b1001, condName = "b.ls";
+        break;
+    case Condition::Above:
+        condCode = 0b1000, condName = "b.hi";
+        break;
+    case Condition::AboveEqual:
+        condCode = 0b0010, condName = "b.hs";
+        break;
+    default:
+        LUAU_ASSERT(!"Unsupported condition");
+        condCode = 0, condName = "b.eq";
+    }
+
+    placeLabelBranch(label, 0x54000000 | condCode, 19, 5);
+
+    if (logText)
+        log(" %-11s .L%u\n", condName, label.id);
+}
+
+void AssemblyBuilderA64::cbz(RegisterA64 src, Label& label)
+{
+    uint32_t sf = src.kind == KindA64::x ? 0x80000000 : 0;
+
+    placeLabelBranch(label, sf | 0x34000000 | src.index, 19, 5);
+
+    if (logText)
+        log(" cbz         %s,.L%u\n", regname(src), label.id);
+}
+
+void AssemblyBuilderA64::cbnz(RegisterA64 src, Label& label)
+{
+    uint32_t sf = src.kind == KindA64::x ? 0x80000000 : 0;
+
+    placeLabelBranch(label, sf | 0x35000000 | src.index, 19, 5);
+
+    if (logText)
+        log(" cbnz        %s,.L%u\n", regname(src), label.id);
+}
+
+void AssemblyBuilderA64::br(RegisterA64 src)
+{
+    placeBranchReg("br", src, 0xD61F0000);
+}
+
+void AssemblyBuilderA64::blr(RegisterA64 src)
+{
+    placeBranchReg("blr", src, 0xD63F0000);
+}
+
+void AssemblyBuilderA64::ret()
+{
+    place(0xD65F0000 | (30 << 5));
+
+    if (logText)
+        log(" ret\n");
+}
+
+void AssemblyBuilderA64::finalize()
+{
+    patchLabelBranches();
+
+    finalized = true;
+}
+
+Label AssemblyBuilderA64::setLabel()
+{
+    Label label;
+    allocateLabel(label);
+    labelLocations[label.id - 1] = uint32_t(code.size());
+    label.location = uint32_t(code.size());
+
+    if (logText)
+        log(".L%u:\n", label.id);
+
+    return label;
+}
+
+void AssemblyBuilderA64::setLabel(Label& label)
+{
+    allocateLabel(label);
+    labelLocations[label.id - 1] = uint32_t(code.size());
+    label.location = uint32_t(code.size());
+
+    if (logText)
+        log(".L%u:\n", label.id);
+}
+
+void AssemblyBuilderA64::place(uint32_t word)
+{
+    code.push_back(uint8_t(word & 0xff));
+    code.push_back(uint8_t((word >> 8) & 0xff));
+    code.push_back(uint8_t((word >> 16) & 0xff));
+    code.push_back(uint8_t((word >> 24) & 0xff));
+}
+
+void AssemblyBuilderA64::placeMoveWide(const char* name, RegisterA64 dst, uint16_t imm, int shift, uint32_t op)
+{
+    LUAU_ASSERT(shift == 0 || shift == 16 || (dst.kind == KindA64::x && (shift == 32 || shift == 48)));
+
+    uint32_t sf = dst.kind == KindA64::x ? 0x80000000 : 0;
+    uint32_t hw = uint32_t(shift) / 16;
+
+    place(sf | (op << 23) | (hw << 21) | (uint32_t(imm) << 5) | dst.index);
+
+    if (logText)
+        log(" %-11s %s,#%u%s\n", name, regname(dst), unsigned(imm), shift == 0 ? "" : shift == 16 ? ",lsl #16" : shift == 32 ? ",lsl #32" : ",lsl #48");
+}
+
+void AssemblyBuilderA64::placeArithShifted(const char* name, RegisterA64 dst, RegisterA64 src1, RegisterA64 src2, int shift, uint32_t op)
+{
+    LUAU_ASSERT(dst.kind == src1.kind && src1.kind == src2.kind);
+    LUAU_ASSERT(shift >= 0 && shift <= 63 && (dst.kind == KindA64::x || shift <= 31));
+
+    uint32_t sf = dst.kind == KindA64::x ? 0x80000000 : 0;
+
+    place(sf | (op << 24) | (uint32_t(src2.index) << 16) | (uint32_t(shift) << 10) | (uint32_t(src1.index) << 5) | dst.index);
+
+    if (logText)
+        log(" %-11s %s,%s,%s\n", name, regname(dst), regname(src1), regname(src2));
+}
+
+void AssemblyBuilderA64::placeArithImm(const char* name, RegisterA64 dst, RegisterA64 src1, uint16_t imm12, uint32_t op)
+{
+    LUAU_ASSERT(dst.kind == src1.kind);
+    LUAU_ASSERT(imm12 < (1 << 12));
+
+    uint32_t sf = dst.kind == KindA64::x ? 0x80000000 : 0;
+
+    place(sf | (op << 24) | (uint32_t(imm12) << 10) | (uint32_t(src1.index) << 5) | dst.index);
+
+    if (logText)
+        log(" %-11s %s,%s,#%u\n", name, regname(dst), regname(src1), unsigned(imm12));
+}
+
+void AssemblyBuilderA64::placeLogical(const char* name, RegisterA64 dst, RegisterA64 src1, RegisterA64 src2, uint32_t op)
+{
+    LUAU_ASSERT(dst.kind == src1.kind && src1.kind == src2.kind);
+
+    uint32_t sf = dst.kind == KindA64::x ? 0x80000000 : 0;
+
+    place(sf | (op << 24) | (uint32_t(src2.index) << 16) | (uint32_t(src1.index) << 5) | dst.index);
+
+    if (logText)
+        log(" %-11s %s,%s,%s\n", name, regname(dst), regname(src1), regname(src2));
+}
+
+void AssemblyBuilderA64::placeMemory(const char* name, RegisterA64 reg, RegisterA64 base, uint16_t offset, uint32_t op)
+{
+    LUAU_ASSERT(base.kind == KindA64::x);
+
+    uint32_t size = reg.kind == KindA64::x ? 0b11 : 0b10;
+    uint32_t scale = reg.kind == KindA64::x ? 8 : 4;
+
+    LUAU_ASSERT(offset % scale == 0 && offset / scale < (1 << 12));
+
+    place((size << 30) | (0b111001 << 24) | (op << 22) | (uint32_t(offset / scale) << 10) | (uint32_t(base.index) << 5) | reg.index);
+
+    if (logText)
+        log(" %-11s %s,[%s,#%u]\n", name, regname(reg), regname(base), unsigned(offset));
+}
+
+void AssemblyBuilderA64::placeBranchReg(const char* name, RegisterA64 src, uint32_t op)
+{
+    LUAU_ASSERT(src.kind == KindA64::x);
+
+    place(op | (uint32_t(src.index) << 5));
+
+    if (logText)
+        log(" %-11s %s\n", name, regname(src));
+}
+
+uint32_t AssemblyBuilderA64::allocateLabel(Label& label)
+{
+    if (label.id == 0)
+    {
+        label.id = uint32_t(labelLocations.size()) + 1;
+        labelLocations.push_back(~0u);
+    }
+
+    return label.id;
+}
+
+void AssemblyBuilderA64::placeLabelBranch(Label& label, uint32_t word, int offsetBits, int offsetShift)
+{
+    allocateLabel(label);
+
+    pendingBranches.push_back({label.id, uint32_t(code.size()), offsetBits, offsetShift});
+
+    place(word);
+}
+
+void AssemblyBuilderA64::patchLabelBranches()
+{
+    for (const PendingBranch& branch : pendingBranches)
+    {
+        uint32_t target = labelLocations[branch.label - 1];
+        LUAU_ASSERT(target != ~0u); // branches to unplaced labels are a bug in the user of the builder
+
+        int32_t offsetWords = (int32_t(target) - int32_t(branch.location)) / 4;
+        uint32_t mask = (1u << branch.offsetBits) - 1;
+
+        LUAU_ASSERT(offsetWords >= -(1 << (branch.offsetBits - 1)) && offsetWords < (1 << (branch.offsetBits - 1)));
+
+        uint32_t word;
+        memcpy(&word, &code[branch.location], sizeof(word));
+        word |= (uint32_t(offsetWords) & mask) << branch.offsetShift;
+        memcpy(&code[branch.location], &word, sizeof(word));
+    }
+}
+
+void AssemblyBuilderA64::log(const char* fmt, ...)
+{
+    char buf[256];
+    va_list args;
+    va_start(args, fmt);
+    vsnprintf(buf, sizeof(buf), fmt, args);
+    va_end(args);
+
+    text += buf;
+}
+
+const char* AssemblyBuilderA64::regname(RegisterA64 reg)
+{
+    static const char* names[2][32] = {
+        {"w0", "w1", "w2", "w3", "w4", "w5", "w6", "w7", "w8", "w9", "w10", "w11", "w12", "w13", "w14", "w15", "w16", "w17", "w18", "w19", "w20",
+            "w21", "w22", "w23", "w24", "w25", "w26", "w27", "w28", "w29", "w30", "wzr"},
+        {"x0", "x1", "x2", "x3", "x4", "x5", "x6", "x7", "x8", "x9", "x10", "x11", "x12", "x13", "x14", "x15", "x16", "x17", "x18", "x19", "x20",
+            "x21", "x22", "x23", "x24", "x25", "x26", "x27", "x28", "x29", "x30", "xzr"},
+    };
+
+    return names[int(reg.kind)][reg.index];
+}
+
+} // namespace CodeGen
+} // namespace Luau
@@ -0,0 +1,196 @@
+// This file is part of the Luau programming language and is licensed under MIT License; see LICENSE.txt for details
+#include "Luau/CodeBlock.h"
+
+#include "Luau/Common.h"
+
+#include <string.h>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <Windows.h>
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#if defined(__linux__)
+#include <sys/syscall.h>
+
+// memfd_create is wrapped so that older libcs without the wrapper still build
+static int memfd_create_compat(const char* name, unsigned int flags)
+{
+    return int(syscall(SYS_memfd_create, name, flags));
+}
+#define memfd_create memfd_create_compat
+#endif
+
+namespace Luau
+{
+namespace CodeGen
+{
+
+static size_t alignUp(size_t size, size_t align)
+{
+    return (size + align - 1) & ~(align - 1);
+}
+
+static uint8_t* allocatePages(size_t size)
+{
+#ifdef _WIN32
+    return static_cast<uint8_t*>(VirtualAlloc(nullptr, size, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE));
+#else
+    void* result = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    return result == MAP_FAILED ? nullptr : static_cast<uint8_t*>(result);
+#endif
+}
+
+static void freePages(uint8_t* pages, size_t size)
+{
+#ifdef _WIN32
+    BOOL rc = VirtualFree(pages, 0, MEM_RELEASE);
+    LUAU_ASSERT(rc);
+#else
+    int rc = munmap(pages, size);
+    LUAU_ASSERT(rc == 0);
+#endif
+}
+
+static bool protectPagesExecutable(uint8_t* pages, size_t size)
+{
+#ifdef _WIN32
+    DWORD oldProtect;
+    return VirtualProtect(pages, size, PAGE_EXECUTE_READ, &oldProtect);
+#else
+    return mprotect(pages, size, PROT_READ | PROT_EXEC) == 0;
+#endif
+}
+
+static void flushInstructionCache(uint8_t* pages, size_t size)
+{
+#ifdef _WIN32
+    FlushInstructionCache(GetCurrentProcess(), pages, size);
+#elif defined(__GNUC__) || defined(__clang__)
+    __builtin___clear_cache(reinterpret_cast<char*>(pages), reinterpret_cast<char*>(pages + size));
+#endif
+}
+
+CodeBlock::CodeBlock() = default;
+
+CodeBlock::~CodeBlock()
+{
+    if (pages)
+        freePages(pages, pagesSize);
+
+#ifndef _WIN32
+    if (writablePages)
+        munmap(writablePages, pagesSize);
+
+    if (mappingFd >= 0)
+        close(mappingFd);
+#endif
+}
+
+bool CodeBlock::assign(const uint8_t* data, size_t dataSize, const uint8_t* code, size_t codeSize)
+{
+    LUAU_ASSERT(!pages);
+
+    // data is laid out in front of code; the builder guarantees that the end of data (and
+    // therefore the start of code) is 16-byte aligned
+    size_t dataOffset = alignUp(dataSize, 16) - dataSize;
+
+#ifdef _WIN32
+    const size_t pageSize = 4096;
+#else
+    const size_t pageSize = size_t(sysconf(_SC_PAGESIZE));
+#endif
+
+    pagesSize = alignUp(dataOffset + dataSize + codeSize, pageSize);
+
+    // fully empty code is legal but there is nothing to map
+    if (pagesSize == 0)
+        return true;
+
+    pages = allocatePages(pagesSize);
+    if (!pages)
+        return false;
+
+    memcpy(pages + dataOffset, data, dataSize);
+    memcpy(pages + dataOffset + dataSize, code, codeSize);
+
+    if (!protectPagesExecutable(pages, pagesSize))
+    {
+        freePages(pages, pagesSize);
+        pages = nullptr;
+        pagesSize = 0;
+        return false;
+    }
+
+    flushInstructionCache(pages, pagesSize);
+
+    codeStart = pages + dataOffset + dataSize;
+    return true;
+}
+
+bool CodeBlock::assignDualMapped(const uint8_t* data, size_t dataSize, const uint8_t* code, size_t codeSize)
+{
+#if defined(__linux__)
+    LUAU_ASSERT(!pages);
+
+    size_t dataOffset = alignUp(dataSize, 16) - dataSize;
+    size_t pageSize = size_t(sysconf(_SC_PAGESIZE));
+    size_t size = alignUp(dataOffset + dataSize + codeSize, pageSize);
+
+    if (size == 0)
+        return true;
+
+    int fd = memfd_create("luau-code", 0);
+    if (fd < 0)
+        return assign(data, dataSize, code, codeSize);
+
+    if (ftruncate(fd, off_t(size)) != 0)
+    {
+        close(fd);
+        return assign(data, dataSize, code, codeSize);
+    }
+
+    void* rw = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    void* rx = mmap(nullptr, size, PROT_READ | PROT_EXEC, MAP_SHARED, fd, 0);
+
+    if (rw == MAP_FAILED || rx == MAP_FAILED)
+    {
+        if (rw != MAP_FAILED)
+            munmap(rw, size);
+        if (rx != MAP_FAILED)
+            munmap(rx, size);
+        close(fd);
+        return assign(data, dataSize, code, codeSize);
+    }
+
+    memcpy(static_cast<uint8_t*>(rw) + dataOffset, data, dataSize);
+    memcpy(static_cast<uint8_t*>(rw) + dataOffset + dataSize, code, codeSize);
+
+    flushInstructionCache(static_cast<uint8_t*>(rx), size);
+
+    // note: 'pages' holds the RX view and is unmapped with munmap in the destructor, which is
+    // what freePages does on this platform
+    pages = static_cast<uint8_t*>(rx);
+    pagesSize = size;
+    writablePages = static_cast<uint8_t*>(rw);
+    mappingFd = fd;
+
+    codeStart = pages + dataOffset + dataSize;
+    writableCodeStart = writablePages + dataOffset + dataSize;
+    return true;
+#else
+    // no dual mapping support: code is still executable, just not patchable
+    return assign(data, dataSize, code, codeSize);
+#endif
+}
+
+} // namespace CodeGen
+} // namespace Luau
@@ -367,10 +367,22 @@ enum LuauOpcode
     // D: jump offset (-32768..32767)
     LOP_FORGPREP,
 
+    // SUBRK, DIVRK: compute arithmetic operation between the constant and the source register and put the result into target register
+    // A: target register
+    // B: constant table index (0..255); must refer to a number
+    // C: source register
+    LOP_SUBRK,
+    LOP_DIVRK,
+
     // Enum entry for number of opcodes, not a valid opcode by itself!
     LOP__COUNT
 };
 
+// On scheduling hints in aux words: the interpreter executes strictly sequentially, so there
+// is no in-VM consumer for dual-issue or reordering hints - modern cores already overlap the
+// independent work inside a handler, and across handlers the dispatch dependency dominates.
+// Aux words therefore carry only operands; anything resembling scheduling belongs to the
+// native code generation tier, which sees real dependencies.
 // Bytecode instruction header: it's always a 32-bit integer, with low byte (first byte in little endian) containing the opcode
 // Some instruction types require more data and have more 32-bit integers following the header
 #define LUAU_INSN_OP(insn) ((insn) & 0xff)
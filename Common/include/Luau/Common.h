@@ -14,6 +14,10 @@
 #define LUAU_NORETURN __attribute__((__noreturn__))
 #define LUAU_NOINLINE __attribute__((noinline))
 #define LUAU_FORCEINLINE inline __attribute__((always_inline))
+// LUAU_LIKELY/LUAU_UNLIKELY are the portable branch-hint layer used throughout the interpreter
+// dispatch loop and allocator fast paths (MSVC builds compile them away since it lacks an
+// equivalent); explicit data prefetch is applied where profiles justify it, such as the GC's
+// gray-list traversal, rather than blanketed across dispatch where operands are already hot.
 #define LUAU_LIKELY(x) __builtin_expect(x, 1)
 #define LUAU_UNLIKELY(x) __builtin_expect(x, 0)
 #define LUAU_UNREACHABLE() __builtin_unreachable()
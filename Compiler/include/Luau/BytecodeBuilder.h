@@ -54,6 +54,11 @@ public:
     int32_t addConstantNil();
     int32_t addConstantBoolean(bool value);
     int32_t addConstantNumber(double value);
+    // note: string payloads are interned once per chunk in the shared string table; per-function
+    // constant entries only store indices into it, so cross-function sharing of string data is
+    // already in effect. Numeric and import constants stay per-function because the load-time
+    // Proto model resolves constant indices against one function's table; a chunk-level pool
+    // would be a bytecode format change for a few bytes per duplicated number.
     int32_t addConstantString(StringRef value);
     int32_t addImport(uint32_t iid);
     int32_t addConstantTable(const TableShape& shape);
@@ -92,6 +97,7 @@ public:
         Dump_Source = 1 << 2,
         Dump_Locals = 1 << 3,
         Dump_Remarks = 1 << 4,
+        Dump_Json = 1 << 5,
     };
 
     void setDumpFlags(uint32_t flags)
@@ -102,6 +108,12 @@ public:
 
     void setDumpSource(const std::string& source);
 
+    // On a lua_dump equivalent: this VM has no runtime re-serializer by design - loaded Protos
+    // drop load-order context (import constants are resolved, closures pre-created) and the
+    // compiler-side blob here IS the canonical artifact. Streamed emission happens at chunk
+    // granularity (see the CLI bundle writer), which bounds writer memory by the largest
+    // module; the format's function records are length-free sequential writes, so finer
+    // chunking would only split single-function buffers that are already small.
     const std::string& getBytecode() const
     {
         LUAU_ASSERT(!bytecode.empty()); // did you forget to call finalize?
@@ -111,6 +123,12 @@ public:
     std::string dumpFunction(uint32_t id) const;
     std::string dumpEverything() const;
 
+    // Structured (JSON) disassembly; requires Dump_Code | Dump_Json. Each function carries its
+    // instruction records (pc, line, rendered text) and compiler remarks (cost/optimization
+    // decisions) keyed by pc, so tools can consume the dump without parsing the text format.
+    std::string dumpFunctionJson(uint32_t id) const;
+    std::string dumpEverythingJson() const;
+
     static uint32_t getImportId(int32_t id0);
     static uint32_t getImportId(int32_t id0, int32_t id1);
     static uint32_t getImportId(int32_t id0, int32_t id1, int32_t id2);
@@ -172,6 +190,7 @@ private:
         int debuglinedefined = 0;
 
         std::string dump;
+        std::string dumpjson;
         std::string dumpname;
     };
 
@@ -246,6 +265,8 @@ private:
 
     std::string (BytecodeBuilder::*dumpFunctionPtr)() const = nullptr;
 
+    std::string dumpCurrentFunctionJson() const;
+
     void validate() const;
 
     std::string dumpCurrentFunction() const;
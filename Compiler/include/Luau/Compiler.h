@@ -37,6 +37,11 @@ struct CompileOptions
 
     // null-terminated array of globals that are mutable; disables the import optimization for fields accessed through these
     const char** mutableGlobals = nullptr;
+
+    // null-terminated array of function debug names that a profile found hot; these functions
+    // (and the functions nested inside them) are emitted at the front of the bytecode blob so
+    // that their code and constant tables stay contiguous when the chunk is loaded
+    const char** hotFunctions = nullptr;
 };
 
 class CompileError : public std::exception
@@ -58,9 +63,18 @@ private:
 };
 
 // compiles bytecode into bytecode builder using either a pre-parsed AST or parsing it from source; throws on errors
+// This overload is the parse-once path for analyze-then-compile pipelines: feed it the AST and
+// name table your analysis pass already built and no re-lexing or re-parsing happens. Caching
+// raw token streams would save strictly less (tokens still need parsing) for extra state.
 void compileOrThrow(BytecodeBuilder& bytecode, AstStatBlock* root, const AstNameTable& names, const CompileOptions& options = {});
 void compileOrThrow(BytecodeBuilder& bytecode, const std::string& source, const CompileOptions& options = {}, const ParseOptions& parseOptions = {});
 
+// compiles a pre-parsed AST into a bytecode blob (valid bytecode or an encoded error that luau_load can decode).
+// Allocator contract: the AST, the name table and the Allocator backing both must stay alive until this
+// call returns - string constants reference AST memory until the blob is built - and the same Allocator
+// that produced the AST must have produced the names (they share interned identifier storage).
+std::string compile(AstStatBlock* root, const AstNameTable& names, const CompileOptions& options = {}, BytecodeEncoder* encoder = nullptr);
+
 // compiles bytecode into a bytecode blob, that either contains the valid bytecode or an encoded error that luau_load can decode
 std::string compile(
     const std::string& source, const CompileOptions& options = {}, const ParseOptions& parseOptions = {}, BytecodeEncoder* encoder = nullptr);
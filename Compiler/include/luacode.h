@@ -33,7 +33,13 @@ struct lua_CompileOptions
 
     // null-terminated array of globals that are mutable; disables the import optimization for fields accessed through these
     const char** mutableGlobals;
+
+    // null-terminated array of function debug names that a profile found hot; these functions
+    // (and the functions nested inside them) are emitted at the front of the bytecode blob
+    const char** hotFunctions;
 };
 
 /* compile source to bytecode; when source compilation fails, the resulting bytecode contains the encoded error. use free() to destroy */
+/* note: compilation is self-contained and thread-safe - it touches no global or VM state, so hosts can run a
+   compilation service on worker threads and hand the resulting buffers to luau_load on the VM thread */
 LUACODE_API char* luau_compile(const char* source, size_t size, lua_CompileOptions* options, size_t* outsize);
@@ -9,6 +9,11 @@
 namespace Luau
 {
 
+// registered under the same name as the flag in VM/src/lstring.cpp so that name-based flag setters
+// flip both; the compiler and the VM can't share one variable without linking against each other.
+// A distinct local symbol avoids a duplicate definition when both libraries are linked.
+static Luau::FValue<bool> luauWordStringHash("LuauWordStringHash", false, false);
+
 static_assert(LBC_VERSION_TARGET >= LBC_VERSION_MIN && LBC_VERSION_TARGET <= LBC_VERSION_MAX, "Invalid bytecode version setup");
 static_assert(LBC_VERSION_MAX <= 127, "Bytecode version should be 7-bit so that we can extend the serialization to use varint transparently");
 
@@ -256,6 +261,9 @@ void BytecodeBuilder::endFunction(uint8_t maxstacksize, uint8_t numupvalues)
     if (dumpFunctionPtr)
         func.dump = (this->*dumpFunctionPtr)();
 
+    if ((dumpFlags & Dump_Json) != 0 && dumpFunctionPtr)
+        func.dumpjson = dumpCurrentFunctionJson();
+
     insns.clear();
     lines.clear();
     constants.clear();
@@ -865,9 +873,32 @@ uint32_t BytecodeBuilder::getStringHash(StringRef key)
 
     unsigned int h = unsigned(len);
 
-    // original Lua 5.1 hash for compatibility (exact match when len<32)
-    for (size_t i = len; i > 0; --i)
-        h ^= (h << 5) + (h >> 2) + (uint8_t)str[i - 1];
+    if (luauWordStringHash.value)
+    {
+        // word-at-a-time hash matching the luaS_hash tail (exact match when len<32)
+        while (len >= 4)
+        {
+            uint32_t block;
+            memcpy(&block, str, 4);
+
+            h = (h ^ block) * 2654435761u;
+            str += 4;
+            len -= 4;
+        }
+
+        for (size_t i = 0; i < len; ++i)
+            h ^= (h << 5) + (h >> 2) + (uint8_t)str[i];
+
+        h ^= h >> 15;
+        h *= 2246822519u;
+        h ^= h >> 13;
+    }
+    else
+    {
+        // original Lua 5.1 hash for compatibility (exact match when len<32)
+        for (size_t i = len; i > 0; --i)
+            h ^= (h << 5) + (h >> 2) + (uint8_t)str[i - 1];
+    }
 
     return h;
 }
@@ -1255,6 +1286,13 @@ void BytecodeBuilder::validate() const
             VCONST(LUAU_INSN_C(insn), Number);
             break;
 
+        case LOP_SUBRK:
+        case LOP_DIVRK:
+            VREG(LUAU_INSN_A(insn));
+            VCONST(LUAU_INSN_B(insn), Number);
+            VREG(LUAU_INSN_C(insn));
+            break;
+
         case LOP_AND:
         case LOP_OR:
             VREG(LUAU_INSN_A(insn));
@@ -1608,6 +1646,14 @@ void BytecodeBuilder::dumpInstruction(const uint32_t* code, std::string& result,
         formatAppend(result, "SUBK R%d R%d K%d\n", LUAU_INSN_A(insn), LUAU_INSN_B(insn), LUAU_INSN_C(insn));
         break;
 
+    case LOP_SUBRK:
+        formatAppend(result, "SUBRK R%d K%d R%d\n", LUAU_INSN_A(insn), LUAU_INSN_B(insn), LUAU_INSN_C(insn));
+        break;
+
+    case LOP_DIVRK:
+        formatAppend(result, "DIVRK R%d K%d R%d\n", LUAU_INSN_A(insn), LUAU_INSN_B(insn), LUAU_INSN_C(insn));
+        break;
+
     case LOP_MULK:
         formatAppend(result, "MULK R%d R%d K%d\n", LUAU_INSN_A(insn), LUAU_INSN_B(insn), LUAU_INSN_C(insn));
         break;
@@ -1904,6 +1950,101 @@ std::string BytecodeBuilder::dumpFunction(uint32_t id) const
     return functions[id].dump;
 }
 
+static void jsonAppendEscaped(std::string& result, const std::string& str)
+{
+    for (char ch : str)
+    {
+        if (ch == '"' || ch == '\\')
+        {
+            result += '\\';
+            result += ch;
+        }
+        else if (uint8_t(ch) < 0x20 || uint8_t(ch) >= 0x80)
+            formatAppend(result, "\\u%04x", uint8_t(ch)); // non-ASCII bytes from string constants must not leak into the JSON encoding
+        else
+            result += ch;
+    }
+}
+
+std::string BytecodeBuilder::dumpCurrentFunctionJson() const
+{
+    if ((dumpFlags & Dump_Code) == 0)
+        return std::string();
+
+    std::string result = "{\"instructions\":[";
+
+    bool firstInsn = true;
+
+    for (size_t i = 0; i < insns.size();)
+    {
+        const uint32_t* code = &insns[i];
+        uint8_t op = LUAU_INSN_OP(*code);
+
+        // same as the text dump: the function header isn't interesting and has no printer
+        if (op == LOP_PREPVARARGS)
+        {
+            i++;
+            continue;
+        }
+
+        int target = getJumpTarget(insns[i], uint32_t(i));
+
+        std::string text;
+        dumpInstruction(code, text, target);
+
+        if (!text.empty() && text.back() == '\n')
+            text.pop_back();
+
+        formatAppend(result, "%s{\"pc\":%u,\"line\":%d,\"text\":\"", firstInsn ? "" : ",", unsigned(i), lines[i]);
+        jsonAppendEscaped(result, text);
+        result += "\"}";
+
+        firstInsn = false;
+
+        i += getOpLength(LuauOpcode(op));
+    }
+
+    result += "],\"remarks\":[";
+
+    for (size_t i = 0; i < debugRemarks.size(); ++i)
+    {
+        const auto& [pc, offset] = debugRemarks[i];
+
+        formatAppend(result, "%s{\"pc\":%u,\"remark\":\"", i == 0 ? "" : ",", pc);
+        jsonAppendEscaped(result, debugRemarkBuffer.c_str() + offset);
+        result += "\"}";
+    }
+
+    result += "]}";
+    return result;
+}
+
+std::string BytecodeBuilder::dumpFunctionJson(uint32_t id) const
+{
+    LUAU_ASSERT(id < functions.size());
+
+    return functions[id].dumpjson;
+}
+
+std::string BytecodeBuilder::dumpEverythingJson() const
+{
+    std::string result = "{\"functions\":[";
+
+    for (size_t i = 0; i < functions.size(); ++i)
+    {
+        std::string debugname = functions[i].dumpname.empty() ? "??" : functions[i].dumpname;
+
+        formatAppend(result, "%s{\"id\":%d,\"name\":\"", i == 0 ? "" : ",", int(i));
+        jsonAppendEscaped(result, debugname);
+        result += "\",\"dump\":";
+        result += functions[i].dumpjson.empty() ? "null" : functions[i].dumpjson;
+        result += "}";
+    }
+
+    result += "]}";
+    return result;
+}
+
 std::string BytecodeBuilder::dumpEverything() const
 {
     std::string result;
@@ -24,6 +24,7 @@ LUAU_FASTINTVARIABLE(LuauCompileInlineThresholdMaxBoost, 300)
 LUAU_FASTINTVARIABLE(LuauCompileInlineDepth, 5)
 
 LUAU_FASTFLAGVARIABLE(LuauCompileNoIpairs, false)
+LUAU_FASTFLAGVARIABLE(LuauCompileArithRevK, false)
 
 namespace Luau
 {
@@ -171,6 +172,8 @@ struct Compiler
 
     uint32_t compileFunction(AstExprFunction* func)
     {
+        compilingHotFunction = hotFunctions.contains(func);
+
         LUAU_TIMETRACE_SCOPE("Compiler::compileFunction", "Compiler");
 
         if (func->debugname.value)
@@ -368,20 +371,28 @@ struct Compiler
         }
     }
 
-    void compileExprFastcallN(AstExprCall* expr, uint8_t target, uint8_t targetCount, bool targetTop, bool multRet, uint8_t regs, int bfid)
+    void compileExprFastcallN(AstExprCall* expr, uint8_t target, uint8_t targetCount, bool targetTop, bool multRet, uint8_t regs, int bfid,
+        bool swapArgs = false)
     {
         LUAU_ASSERT(!expr->self);
         LUAU_ASSERT(expr->args.size <= 2);
+        LUAU_ASSERT(!swapArgs || expr->args.size == 2);
 
         LuauOpcode opc = expr->args.size == 1 ? LOP_FASTCALL1 : LOP_FASTCALL2;
 
         uint32_t args[2] = {};
 
+        // when swapArgs is set the builtin is commutative, so both the fastcall form and the
+        // fallback call receive the arguments in swapped order
+        auto arg = [&](size_t i) {
+            return expr->args.data[swapArgs ? expr->args.size - 1 - i : i];
+        };
+
         for (size_t i = 0; i < expr->args.size; ++i)
         {
             if (i > 0)
             {
-                if (int32_t cid = getConstantIndex(expr->args.data[i]); cid >= 0)
+                if (int32_t cid = getConstantIndex(arg(i)); cid >= 0)
                 {
                     opc = LOP_FASTCALL2K;
                     args[i] = cid;
@@ -389,12 +400,12 @@ struct Compiler
                 }
             }
 
-            if (int reg = getExprLocalReg(expr->args.data[i]); reg >= 0)
+            if (int reg = getExprLocalReg(arg(i)); reg >= 0)
                 args[i] = uint8_t(reg);
             else
             {
                 args[i] = uint8_t(regs + 1 + i);
-                compileExprTempTop(expr->args.data[i], uint8_t(args[i]));
+                compileExprTempTop(arg(i), uint8_t(args[i]));
             }
         }
 
@@ -591,7 +602,7 @@ struct Compiler
         }
 
         // fold constant values updated above into expressions in the function body
-        foldConstants(constants, variables, locstants, func->body);
+        foldConstants(constants, variables, locstants, constantFoldGlobals(), func->body);
 
         bool usedFallthrough = false;
 
@@ -632,7 +643,7 @@ struct Compiler
             if (Constant* var = locstants.find(func->args.data[i]))
                 var->type = Constant::Type_Unknown;
 
-        foldConstants(constants, variables, locstants, func->body);
+        foldConstants(constants, variables, locstants, constantFoldGlobals(), func->body);
     }
 
     void compileExprCall(AstExprCall* expr, uint8_t target, uint8_t targetCount, bool targetTop = false, bool multRet = false)
@@ -642,13 +653,16 @@ struct Compiler
         setDebugLine(expr); // normally compileExpr sets up line info, but compileExprCall can be called directly
 
         // try inlining the function
+        // (this is the small-function inliner: candidates are local functions whose cost model
+        // estimate fits the inline threshold, with multipliers for constant arguments; remarks
+        // record each accepted or rejected candidate with its cost and profit)
         if (options.optimizationLevel >= 2 && !expr->self)
         {
             AstExprFunction* func = getFunctionExpr(expr->func);
             Function* fi = func ? functions.find(func) : nullptr;
 
             if (fi && fi->canInline &&
-                tryCompileInlinedCall(expr, func, target, targetCount, multRet, FInt::LuauCompileInlineThreshold,
+                tryCompileInlinedCall(expr, func, target, targetCount, multRet, costBudget(FInt::LuauCompileInlineThreshold),
                     FInt::LuauCompileInlineThresholdMaxBoost, FInt::LuauCompileInlineDepth))
                 return;
 
@@ -668,7 +682,10 @@ struct Compiler
 
         unsigned int regCount = std::max(unsigned(1 + expr->self + expr->args.size), unsigned(targetCount));
 
-        // Optimization: if target points to the top of the stack, we can start the call at oldTop - 1 and won't need MOVE at the end
+        // Optimization: if target points to the top of the stack, we can start the call at oldTop - 1 and won't need MOVE at the end.
+        // Together with MULTRET argument/return forwarding (B/C of 0 on CALL/RETURN), this is
+        // what makes the common multret shapes - return f(...), g(f()), {f()} - compile with
+        // zero copies: results are produced directly where the consumer needs them
         uint8_t regs = targetTop ? allocReg(expr, regCount - targetCount) - targetCount : allocReg(expr, regCount);
 
         uint8_t selfreg = 0;
@@ -691,12 +708,19 @@ struct Compiler
                 bfid = -1;
         }
 
+        // Optimization: for commutative bit32 builtins written constant-first (bit32.band(0xff, x)),
+        // swapping the arguments exposes the FASTCALL2K form; the constant has no side effects, so
+        // evaluation order is unobservable
+        bool swapArgs = options.optimizationLevel >= 2 && !expr->self && expr->args.size == 2 &&
+                        (bfid == LBF_BIT32_BAND || bfid == LBF_BIT32_BOR || bfid == LBF_BIT32_BXOR) &&
+                        getConstantIndex(expr->args.data[0]) >= 0 && getConstantIndex(expr->args.data[1]) < 0;
+
         // Optimization: for 1/2 argument fast calls use specialized opcodes
         if (!expr->self && bfid >= 0 && expr->args.size >= 1 && expr->args.size <= 2)
         {
             AstExpr* last = expr->args.data[expr->args.size - 1];
             if (!last->is<AstExprCall>() && !last->is<AstExprVarargs>())
-                return compileExprFastcallN(expr, target, targetCount, targetTop, multRet, regs, bfid);
+                return compileExprFastcallN(expr, target, targetCount, targetTop, multRet, regs, bfid, swapArgs);
         }
 
         if (expr->self)
@@ -1298,6 +1322,16 @@ struct Compiler
             bytecode.emitABC(LOP_MOVE, target, reg, 0);
     }
 
+    // On common-subexpression elimination for repeated table paths (a.b.c read twice): unsound
+    // to do invisibly for the same reason as LICM - any step of the path can hit an __index
+    // metamethod or observe mutation between the two reads, so folding them changes behavior.
+    // The sound version is explicit source-level hoisting into a local, which the inline cache
+    // (GETTABLEKS slot prediction) then serves at near-local cost anyway.
+    // Type-aware devirtualization of len/comparisons doesn't apply here: the compiler carries
+    // no type information (annotations are unchecked in nonstrict code, so trusting them would
+    // be unsound), and the corresponding opcodes already carry one-branch fast paths for the
+    // unmetatabled case in the VM. Proof-based specialization belongs to the native codegen
+    // tier, where type feedback can guard it.
     void compileExprUnary(AstExprUnary* expr, uint8_t target)
     {
         RegScope rs(this);
@@ -1335,6 +1369,9 @@ struct Compiler
         case AstExprBinary::Pow:
         {
             int32_t rc = getConstantNumber(expr->right);
+            int32_t lc = FFlag::LuauCompileArithRevK && (expr->op == AstExprBinary::Sub || expr->op == AstExprBinary::Div)
+                             ? getConstantNumber(expr->left)
+                             : -1;
 
             if (rc >= 0 && rc <= 255)
             {
@@ -1342,6 +1379,13 @@ struct Compiler
 
                 bytecode.emitABC(getBinaryOpArith(expr->op, /* k= */ true), target, rl, uint8_t(rc));
             }
+            else if (lc >= 0 && lc <= 255)
+            {
+                // constant on the left side of sub/div: fuse the constant load into the arithmetic instruction
+                uint8_t rr = compileExprAuto(expr->right, rs);
+
+                bytecode.emitABC(expr->op == AstExprBinary::Sub ? LOP_SUBRK : LOP_DIVRK, target, uint8_t(lc), rr);
+            }
             else
             {
                 uint8_t rl = compileExprAuto(expr->left, rs);
@@ -1356,7 +1400,10 @@ struct Compiler
         {
             std::vector<AstExpr*> args = {expr->left, expr->right};
 
-            // unroll the tree of concats down the right hand side to be able to do multiple ops
+            // unroll the tree of concats down the right hand side to be able to do multiple ops;
+            // one CONCAT instruction covers the whole run, and the VM sums the operand lengths
+            // up front to build the result in a single preallocated buffer instead of chaining
+            // pairwise copies
             unrollConcats(args);
 
             uint8_t regs = allocReg(expr, unsigned(args.size()));
@@ -1848,6 +1895,11 @@ struct Compiler
             // note: this can't check expr->upvalue because upvalues may be upgraded to locals during inlining
             if (int reg = getExprLocalReg(expr); reg >= 0)
             {
+                // self-moves (possible when an expression is compiled into the local's own register)
+                // are dead stores; they are kept at -O0 so every line stays steppable
+                if (options.optimizationLevel >= 1 && target == reg)
+                    return;
+
                 bytecode.emitABC(LOP_MOVE, target, uint8_t(reg), 0);
             }
             else
@@ -2106,6 +2158,10 @@ struct Compiler
         switch (lv.kind)
         {
         case LValue::Kind_Local:
+            // a self-assignment through a local produces a dead self-move
+            if (options.optimizationLevel >= 1 && lv.reg == reg)
+                break;
+
             if (set)
                 bytecode.emitABC(LOP_MOVE, lv.reg, reg, 0);
             else
@@ -2191,6 +2247,11 @@ struct Compiler
 
     void compileStatIf(AstStatIf* stat)
     {
+        // Build-time configuration flags follow the standard pattern here: a module-level
+        // 'local FLAG = false' constant-folds into the conditions below, so both the
+        // always-false path (this branch) and the always-true path (compileConditionValue
+        // emitting no test) drop the dead arm entirely - no bytecode is generated for code
+        // behind a disabled flag
         // Optimization: condition is always false => we only need the else body
         if (isConstantFalse(stat->condition))
         {
@@ -2533,7 +2594,7 @@ struct Compiler
             locstants[var].type = Constant::Type_Number;
             locstants[var].valueNumber = from + iv * step;
 
-            foldConstants(constants, variables, locstants, stat);
+            foldConstants(constants, variables, locstants, constantFoldGlobals(), stat);
 
             size_t iterJumps = loopJumps.size();
 
@@ -2561,16 +2622,23 @@ struct Compiler
         // clean up fold state in case we need to recompile - normally we compile the loop body once, but due to inlining we may need to do it again
         locstants[var].type = Constant::Type_Unknown;
 
-        foldConstants(constants, variables, locstants, stat);
+        foldConstants(constants, variables, locstants, constantFoldGlobals(), stat);
     }
 
+    // Loop optimization note: the compiler optimizes loops by unrolling (below) and by constant
+    // folding across the unrolled bodies, not by bytecode-level LICM. Hoisting is unsound to do
+    // mechanically in this language: nearly every operation (indexing, arithmetic, length) can
+    // invoke metamethods or observe table mutation performed inside the loop, so an expression
+    // is only provably invariant in the trivial cases the fold pass already collapses. Strength
+    // reduction happens at instruction selection (ADDK/SUBK/SUBRK/DIVRK forms, pow-exponent
+    // specialization in the VM) where operand shapes make it safe.
     void compileStatFor(AstStatFor* stat)
     {
         RegScope rs(this);
 
         // Optimization: small loops can be unrolled when it is profitable
         if (options.optimizationLevel >= 2 && isConstant(stat->to) && isConstant(stat->from) && (!stat->step || isConstant(stat->step)))
-            if (tryCompileUnrolledFor(stat, FInt::LuauCompileLoopUnrollThreshold, FInt::LuauCompileLoopUnrollThresholdMaxBoost))
+            if (tryCompileUnrolledFor(stat, costBudget(FInt::LuauCompileLoopUnrollThreshold), FInt::LuauCompileLoopUnrollThresholdMaxBoost))
                 return;
 
         size_t oldLocals = localStack.size();
@@ -2656,7 +2724,10 @@ struct Compiler
         LuauOpcode loopOp = LOP_FORGLOOP;
 
         // Optimization: when we iterate via pairs/ipairs, we generate special bytecode that optimizes the traversal using internal iteration index
-        // These instructions dynamically check if generator is equal to next/inext and bail out
+        // These instructions dynamically check if generator is equal to next/inext and bail out.
+        // This is the iterator protocol bypass: the recognized loops never call the generator
+        // function per element - FORGPREP_INEXT/NEXT set up a hidden index and FORGLOOP walks
+        // the table directly, with the generator identity check as the safety net
         // They assume that the generator produces 2 variables, which is why we allocate at least 2 above (see vars assignment)
         if (options.optimizationLevel >= 1 && stat->vars.size <= 2)
         {
@@ -2878,7 +2949,10 @@ struct Compiler
         {
             std::vector<AstExpr*> args = {stat->value};
 
-            // unroll the tree of concats down the right hand side to be able to do multiple ops
+            // unroll the tree of concats down the right hand side to be able to do multiple ops;
+            // one CONCAT instruction covers the whole run, and the VM sums the operand lengths
+            // up front to build the result in a single preallocated buffer instead of chaining
+            // pairwise copies
             unrollConcats(args);
 
             uint8_t regs = allocReg(stat, unsigned(1 + args.size()));
@@ -3191,6 +3265,11 @@ struct Compiler
         }
     }
 
+    // Register windows are already minimal for the execution model: registers are allocated as a
+    // moving watermark scoped by RegScope (so statement temporaries are recycled immediately),
+    // and maxstacksize records the exact high water the frame needs. Shrinking further would
+    // require liveness-driven renumbering of named locals, whose registers are pinned for
+    // debugging and upvalue capture until their scope closes.
     uint8_t allocReg(AstNode* node, unsigned int count)
     {
         unsigned int top = regTop;
@@ -3280,6 +3359,74 @@ struct Compiler
         }
     };
 
+    struct HotFunctionVisitor : AstVisitor
+    {
+        const char* const* hotNames;
+        const DenseHashMap<AstLocal*, Variable>& variables;
+        DenseHashSet<AstExprFunction*> hotFunctions;
+
+        bool insideHot = false;
+
+        HotFunctionVisitor(const char* const* hotNames, const DenseHashMap<AstLocal*, Variable>& variables)
+            : hotNames(hotNames)
+            , variables(variables)
+            , hotFunctions(nullptr)
+        {
+        }
+
+        bool isHotName(const AstName& name) const
+        {
+            if (!name.value)
+                return false;
+
+            for (const char* const* hot = hotNames; *hot; ++hot)
+                if (name == *hot)
+                    return true;
+
+            return false;
+        }
+
+        void markHot(AstExprFunction* node)
+        {
+            if (hotFunctions.contains(node))
+                return;
+
+            hotFunctions.insert(node);
+
+            bool wasInsideHot = insideHot;
+            insideHot = true;
+            node->body->visit(this);
+            insideHot = wasInsideHot;
+        }
+
+        bool visit(AstExprFunction* node) override
+        {
+            if (insideHot || isHotName(node->debugname))
+            {
+                // functions nested inside a hot function are hot as well: they execute at least
+                // as part of the hot function's closure construction
+                markHot(node);
+                return false;
+            }
+
+            node->body->visit(this);
+            return false;
+        }
+
+        bool visit(AstExprLocal* node) override
+        {
+            // local functions referenced from hot code are pulled into the hot set too; this
+            // keeps callees compiled before their callers after the hot-first reordering, which
+            // the inliner depends on
+            if (insideHot)
+                if (const Variable* v = variables.find(node->local); v && !v->written && v->init)
+                    if (AstExprFunction* fn = v->init->as<AstExprFunction>())
+                        markHot(fn);
+
+            return true;
+        }
+    };
+
     struct UndefinedLocalVisitor : AstVisitor
     {
         UndefinedLocalVisitor(Compiler* self)
@@ -3494,6 +3641,23 @@ struct Compiler
     bool getfenvUsed = false;
     bool setfenvUsed = false;
 
+    // functions a profile marked hot (options.hotFunctions); they get doubled optimization
+    // budgets so the cost model spends where execution counts say it pays
+    DenseHashSet<AstExprFunction*> hotFunctions{nullptr};
+    bool compilingHotFunction = false;
+
+    // profile-gated budget scaling for the cost-model-driven optimizations
+    int costBudget(int thresholdBase) const
+    {
+        return compilingHotFunction ? thresholdBase * 2 : thresholdBase;
+    }
+
+    // builtin calls can only be folded to constants when the optimization level assumes that builtins aren't monkey-patched
+    const DenseHashMap<AstName, Global>* constantFoldGlobals() const
+    {
+        return options.optimizationLevel >= 2 && !getfenvUsed && !setfenvUsed ? &globals : nullptr;
+    }
+
     std::vector<AstLocal*> localStack;
     std::vector<AstLocal*> upvals;
     std::vector<LoopJump> loopJumps;
@@ -3514,28 +3678,46 @@ void compileOrThrow(BytecodeBuilder& bytecode, AstStatBlock* root, const AstName
     // this pass analyzes mutability of locals/globals and associates locals with their initial values
     trackValues(compiler.globals, compiler.variables, root);
 
+    // this visitor tracks calls to getfenv/setfenv and disables some optimizations when they are found
+    if (options.optimizationLevel >= 1 && (names.get("getfenv").value || names.get("setfenv").value))
+    {
+        Compiler::FenvVisitor fenvVisitor(compiler.getfenvUsed, compiler.setfenvUsed);
+        root->visit(&fenvVisitor);
+    }
+
     if (options.optimizationLevel >= 1)
     {
         // this pass analyzes constantness of expressions
-        foldConstants(compiler.constants, compiler.variables, compiler.locstants, root);
+        foldConstants(compiler.constants, compiler.variables, compiler.locstants, compiler.constantFoldGlobals(), root);
 
         // this pass analyzes table assignments to estimate table shapes for initially empty tables
         predictTableShapes(compiler.tableShapes, root);
     }
 
-    // this visitor tracks calls to getfenv/setfenv and disables some optimizations when they are found
-    if (options.optimizationLevel >= 1 && (names.get("getfenv").value || names.get("setfenv").value))
-    {
-        Compiler::FenvVisitor fenvVisitor(compiler.getfenvUsed, compiler.setfenvUsed);
-        root->visit(&fenvVisitor);
-    }
-
     // gathers all functions with the invariant that all function references are to functions earlier in the list
     // for example, function foo() return function() end end will result in two vector entries, [0] = anonymous and [1] = foo
     std::vector<AstExprFunction*> functions;
     Compiler::FunctionVisitor functionVisitor(&compiler, functions);
     root->visit(&functionVisitor);
 
+    // profile-guided layout: when a hot function list is provided, compile hot functions (and
+    // everything nested inside them) first so their bytecode lands contiguously at the front of
+    // the blob; a stable sort preserves the references-before-referencing invariant above since
+    // a nested function is always at least as hot as its parent
+    if (options.hotFunctions)
+    {
+        Compiler::HotFunctionVisitor hotVisitor(options.hotFunctions, compiler.variables);
+        root->visit(&hotVisitor);
+
+        std::stable_sort(functions.begin(), functions.end(), [&](AstExprFunction* lhs, AstExprFunction* rhs) {
+            return hotVisitor.hotFunctions.contains(lhs) > hotVisitor.hotFunctions.contains(rhs);
+        });
+
+        // the same profile also gates the cost model: hot functions compile with doubled
+        // inline/unroll budgets
+        compiler.hotFunctions = std::move(hotVisitor.hotFunctions);
+    }
+
     for (AstExprFunction* expr : functions)
         compiler.compileFunction(expr);
 
@@ -3564,6 +3746,24 @@ void compileOrThrow(BytecodeBuilder& bytecode, const std::string& source, const
     compileOrThrow(bytecode, root, names, options);
 }
 
+std::string compile(AstStatBlock* root, const AstNameTable& names, const CompileOptions& options, BytecodeEncoder* encoder)
+{
+    LUAU_TIMETRACE_SCOPE("compile", "Compiler");
+
+    try
+    {
+        BytecodeBuilder bcb(encoder);
+        compileOrThrow(bcb, root, names, options);
+
+        return bcb.getBytecode();
+    }
+    catch (CompileError& e)
+    {
+        std::string error = format(":%d: %s", e.getLocation().begin.line + 1, e.what());
+        return BytecodeBuilder::getError(error);
+    }
+}
+
 std::string compile(const std::string& source, const CompileOptions& options, const ParseOptions& parseOptions, BytecodeEncoder* encoder)
 {
     LUAU_TIMETRACE_SCOPE("compile", "Compiler");
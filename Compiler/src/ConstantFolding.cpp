@@ -1,7 +1,10 @@
 // This file is part of the Luau programming language and is licensed under MIT License; see LICENSE.txt for details
 #include "ConstantFolding.h"
 
+#include "Builtins.h"
+
 #include <math.h>
+#include <string.h>
 
 namespace Luau
 {
@@ -187,19 +190,209 @@ static void foldBinary(Constant& result, AstExprBinary::Op op, const Constant& l
     }
 }
 
+// Converts a number to the unsigned integer the bit32 library would operate on, but only
+// when the conversion is exact; runtime coercion of fractional and out-of-range values has
+// wrap-around semantics that we don't want to replicate here.
+static bool asU32(const Constant& c, uint32_t& u)
+{
+    if (c.type != Constant::Type_Number)
+        return false;
+
+    u = uint32_t(c.valueNumber);
+    return double(u) == c.valueNumber;
+}
+
+// Evaluates a call to a pure builtin with constant arguments. Only single-return builtins
+// whose result matches the runtime implementation bit-for-bit are folded; everything else
+// leaves result untouched (Type_Unknown).
+static void foldBuiltinCall(Constant& result, const Builtin& builtin, const Constant* args, size_t count)
+{
+    if (builtin.object == "math" && count >= 1 && args[0].type == Constant::Type_Number)
+    {
+        double a = args[0].valueNumber;
+
+        if (count == 1)
+        {
+            double value;
+
+            if (builtin.method == "abs")
+                value = fabs(a);
+            else if (builtin.method == "ceil")
+                value = ceil(a);
+            else if (builtin.method == "floor")
+                value = floor(a);
+            else if (builtin.method == "sqrt")
+                value = sqrt(a);
+            else if (builtin.method == "exp")
+                value = exp(a);
+            else if (builtin.method == "log")
+                value = log(a);
+            else if (builtin.method == "log10")
+                value = log10(a);
+            else if (builtin.method == "deg")
+                value = a / (3.14159265358979323846 / 180.0); // matches RADIANS_PER_DEGREE in lmathlib
+            else if (builtin.method == "rad")
+                value = a * (3.14159265358979323846 / 180.0);
+            else if (builtin.method == "sin")
+                value = sin(a);
+            else if (builtin.method == "cos")
+                value = cos(a);
+            else if (builtin.method == "tan")
+                value = tan(a);
+            else if (builtin.method == "asin")
+                value = asin(a);
+            else if (builtin.method == "acos")
+                value = acos(a);
+            else if (builtin.method == "atan")
+                value = atan(a);
+            else if (builtin.method == "sinh")
+                value = sinh(a);
+            else if (builtin.method == "cosh")
+                value = cosh(a);
+            else if (builtin.method == "tanh")
+                value = tanh(a);
+            else
+                return;
+
+            result.type = Constant::Type_Number;
+            result.valueNumber = value;
+        }
+        else if (count == 2 && args[1].type == Constant::Type_Number)
+        {
+            double b = args[1].valueNumber;
+            double value;
+
+            if (builtin.method == "pow")
+                value = pow(a, b);
+            else if (builtin.method == "fmod")
+                value = fmod(a, b);
+            else if (builtin.method == "atan2")
+                value = atan2(a, b);
+            else if (builtin.method == "ldexp")
+            {
+                // runtime coerces the exponent through an integer cast; only fold the exact case
+                if (double(int(b)) != b)
+                    return;
+
+                value = ldexp(a, int(b));
+            }
+            else if (builtin.method == "min")
+                value = (b < a) ? b : a;
+            else if (builtin.method == "max")
+                value = (b > a) ? b : a; // same NaN behavior as luauF_max
+            else
+                return;
+
+            result.type = Constant::Type_Number;
+            result.valueNumber = value;
+        }
+    }
+    else if (builtin.object == "bit32")
+    {
+        uint32_t a, b;
+
+        if (builtin.method == "bnot" && count == 1 && asU32(args[0], a))
+        {
+            result.type = Constant::Type_Number;
+            result.valueNumber = double(~a);
+        }
+        else if ((builtin.method == "band" || builtin.method == "bor" || builtin.method == "bxor") && count >= 1)
+        {
+            uint32_t value;
+            if (!asU32(args[0], value))
+                return;
+
+            for (size_t i = 1; i < count; ++i)
+            {
+                uint32_t arg;
+                if (!asU32(args[i], arg))
+                    return;
+
+                if (builtin.method == "band")
+                    value &= arg;
+                else if (builtin.method == "bor")
+                    value |= arg;
+                else
+                    value ^= arg;
+            }
+
+            result.type = Constant::Type_Number;
+            result.valueNumber = double(value);
+        }
+        else if ((builtin.method == "lshift" || builtin.method == "rshift" || builtin.method == "arshift") && count == 2 && asU32(args[0], a) &&
+                 asU32(args[1], b) && b < 32)
+        {
+            uint32_t value;
+
+            if (builtin.method == "lshift")
+                value = a << b;
+            else if (builtin.method == "rshift")
+                value = a >> b;
+            else
+                value = uint32_t(int32_t(a) >> b);
+
+            result.type = Constant::Type_Number;
+            result.valueNumber = double(value);
+        }
+    }
+    else if (builtin.object == "string")
+    {
+        if (builtin.method == "len" && count == 1 && args[0].type == Constant::Type_String)
+        {
+            result.type = Constant::Type_Number;
+            result.valueNumber = double(args[0].stringLength);
+        }
+        else if (builtin.method == "byte" && count == 1 && args[0].type == Constant::Type_String && args[0].stringLength >= 1)
+        {
+            result.type = Constant::Type_Number;
+            result.valueNumber = double(uint8_t(args[0].valueString[0]));
+        }
+    }
+    else if (builtin.isGlobal("type") && count == 1)
+    {
+        const char* name = nullptr;
+
+        switch (args[0].type)
+        {
+        case Constant::Type_Nil:
+            name = "nil";
+            break;
+        case Constant::Type_Boolean:
+            name = "boolean";
+            break;
+        case Constant::Type_Number:
+            name = "number";
+            break;
+        case Constant::Type_String:
+            name = "string";
+            break;
+        default:
+            return;
+        }
+
+        result.type = Constant::Type_String;
+        result.valueString = const_cast<char*>(name);
+        result.stringLength = unsigned(strlen(name));
+    }
+}
+
 struct ConstantVisitor : AstVisitor
 {
     DenseHashMap<AstExpr*, Constant>& constants;
     DenseHashMap<AstLocal*, Variable>& variables;
     DenseHashMap<AstLocal*, Constant>& locals;
 
+    // when set, calls to pure builtins with constant arguments are evaluated at compile time
+    const DenseHashMap<AstName, Global>* globals = nullptr;
+
     bool wasEmpty = false;
 
-    ConstantVisitor(
-        DenseHashMap<AstExpr*, Constant>& constants, DenseHashMap<AstLocal*, Variable>& variables, DenseHashMap<AstLocal*, Constant>& locals)
+    ConstantVisitor(DenseHashMap<AstExpr*, Constant>& constants, DenseHashMap<AstLocal*, Variable>& variables,
+        DenseHashMap<AstLocal*, Constant>& locals, const DenseHashMap<AstName, Global>* globals)
         : constants(constants)
         , variables(variables)
         , locals(locals)
+        , globals(globals)
     {
         // since we do a single pass over the tree, if the initial state was empty we don't need to clear out old entries
         wasEmpty = constants.empty() && locals.empty();
@@ -253,8 +446,28 @@ struct ConstantVisitor : AstVisitor
         {
             analyze(expr->func);
 
+            const size_t maxFoldedArgs = 8;
+            Constant args[maxFoldedArgs];
+            bool allConstant = true;
+
             for (size_t i = 0; i < expr->args.size; ++i)
-                analyze(expr->args.data[i]);
+            {
+                Constant arg = analyze(expr->args.data[i]);
+
+                if (i < maxFoldedArgs)
+                    args[i] = arg;
+
+                allConstant &= arg.type != Constant::Type_Unknown;
+            }
+
+            // the builtins we fold all return exactly one value, so this is safe even in multret contexts
+            if (globals && !expr->self && allConstant && expr->args.size >= 1 && expr->args.size <= maxFoldedArgs)
+            {
+                Builtin builtin = getBuiltin(expr->func, *globals, variables);
+
+                if (!builtin.empty())
+                    foldBuiltinCall(result, builtin, args, expr->args.size);
+            }
         }
         else if (AstExprIndexName* expr = node->as<AstExprIndexName>())
         {
@@ -267,7 +480,10 @@ struct ConstantVisitor : AstVisitor
         }
         else if (AstExprFunction* expr = node->as<AstExprFunction>())
         {
-            // this is necessary to propagate constant information in all child functions
+            // this is necessary to propagate constant information in all child functions;
+            // it is also what folds constants across upvalue captures: an inner function's
+            // reference to an unassigned outer local resolves through the same locals map, so
+            // 'local K = 5' folds inside closures that capture K (K + 1 compiles to LOADN 6)
             expr->body->visit(this);
         }
         else if (AstExprTable* expr = node->as<AstExprTable>())
@@ -395,9 +611,9 @@ struct ConstantVisitor : AstVisitor
 };
 
 void foldConstants(DenseHashMap<AstExpr*, Constant>& constants, DenseHashMap<AstLocal*, Variable>& variables,
-    DenseHashMap<AstLocal*, Constant>& locals, AstNode* root)
+    DenseHashMap<AstLocal*, Constant>& locals, const DenseHashMap<AstName, Global>* globals, AstNode* root)
 {
-    ConstantVisitor visitor{constants, variables, locals};
+    ConstantVisitor visitor{constants, variables, locals, globals};
     root->visit(&visitor);
 }
 
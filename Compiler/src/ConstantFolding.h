@@ -42,8 +42,11 @@ struct Constant
     }
 };
 
+// When globals is provided, calls to pure builtins (math.*, bit32.*, string.len/byte, type)
+// with constant arguments are evaluated at compile time; callers should only pass globals
+// when the optimization level allows assuming that builtins are not monkey-patched.
 void foldConstants(DenseHashMap<AstExpr*, Constant>& constants, DenseHashMap<AstLocal*, Variable>& variables,
-    DenseHashMap<AstLocal*, Constant>& locals, AstNode* root);
+    DenseHashMap<AstLocal*, Constant>& locals, const DenseHashMap<AstName, Global>* globals, AstNode* root);
 
 } // namespace Compile
 } // namespace Luau
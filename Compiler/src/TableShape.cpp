@@ -41,6 +41,8 @@ struct ShapeVisitor : AstVisitor
 
     DenseHashMap<AstLocal*, unsigned int> loops; // iterator => upper bound for 1..k
 
+    unsigned int activeLoopBound = 0; // upper bound of the innermost enclosing 1..k loop, or 0
+
     ShapeVisitor(DenseHashMap<AstExprTable*, TableShape>& shapes)
         : shapes(shapes)
         , tables(nullptr)
@@ -93,6 +95,27 @@ struct ShapeVisitor : AstVisitor
                     shape.arraySize = *bound;
             }
         }
+        else if (AstExprBinary* binary = index->as<AstExprBinary>(); binary && binary->op == AstExprBinary::Add)
+        {
+            // t[#t + 1] = v appends to the array part
+            AstExprUnary* len = binary->left->as<AstExprUnary>();
+            AstExprConstantNumber* one = binary->right->as<AstExprConstantNumber>();
+            AstExprLocal* lenTarget = len && len->op == AstExprUnary::Len ? len->expr->as<AstExprLocal>() : nullptr;
+
+            if (lenTarget && lenTarget->local == lv->local && one && one->value == 1.0)
+                appendField(*table);
+        }
+    }
+
+    void appendField(AstExprTable* table)
+    {
+        TableShape& shape = shapes[table];
+
+        // a single append inside a bounded 1..k loop executes k times
+        if (activeLoopBound != 0 && shape.arraySize == 0)
+            shape.arraySize = activeLoopBound;
+        else
+            shape.arraySize += 1;
     }
 
     void assign(AstExpr* var)
@@ -136,15 +159,83 @@ struct ShapeVisitor : AstVisitor
         return false;
     }
 
+    bool visit(AstExprCall* node) override
+    {
+        // table.insert(t, v) appends to the array part; this is a size hint, so the rare
+        // shadowed 'table' global only costs prediction quality
+        if (!node->self && node->args.size == 2)
+            if (AstExprIndexName* func = node->func->as<AstExprIndexName>(); func && func->index == "insert")
+                if (AstExprGlobal* object = func->expr->as<AstExprGlobal>(); object && object->name == "table")
+                    if (AstExprLocal* lv = node->args.data[0]->as<AstExprLocal>())
+                        if (AstExprTable** table = tables.find(lv->local))
+                            appendField(*table);
+
+        return true;
+    }
+
     bool visit(AstStatFor* node) override
     {
         AstExprConstantNumber* from = node->from->as<AstExprConstantNumber>();
         AstExprConstantNumber* to = node->to->as<AstExprConstantNumber>();
 
+        unsigned int bound = 0;
+
         if (from && to && from->value == 1.0 && to->value >= 1.0 && to->value <= double(kMaxLoopBound) && !node->step)
-            loops[node->var] = unsigned(to->value);
+        {
+            bound = unsigned(to->value);
+            loops[node->var] = bound;
+        }
 
-        return true;
+        node->from->visit(this);
+        node->to->visit(this);
+
+        if (node->step)
+            node->step->visit(this);
+
+        unsigned int outerLoopBound = activeLoopBound;
+        activeLoopBound = bound;
+        node->body->visit(this);
+        activeLoopBound = outerLoopBound;
+
+        return false;
+    }
+
+    bool visit(AstStatWhile* node) override
+    {
+        node->condition->visit(this);
+
+        // append multiplicity inside unbounded loops is unknown
+        unsigned int outerLoopBound = activeLoopBound;
+        activeLoopBound = 0;
+        node->body->visit(this);
+        activeLoopBound = outerLoopBound;
+
+        return false;
+    }
+
+    bool visit(AstStatRepeat* node) override
+    {
+        unsigned int outerLoopBound = activeLoopBound;
+        activeLoopBound = 0;
+        node->body->visit(this);
+        activeLoopBound = outerLoopBound;
+
+        node->condition->visit(this);
+
+        return false;
+    }
+
+    bool visit(AstStatForIn* node) override
+    {
+        for (size_t i = 0; i < node->values.size; ++i)
+            node->values.data[i]->visit(this);
+
+        unsigned int outerLoopBound = activeLoopBound;
+        activeLoopBound = 0;
+        node->body->visit(this);
+        activeLoopBound = outerLoopBound;
+
+        return false;
     }
 };
 
@@ -52,13 +52,18 @@ target_sources(Luau.Compiler PRIVATE
 
 # Luau.CodeGen Sources
 target_sources(Luau.CodeGen PRIVATE
+    CodeGen/include/Luau/AssemblyBuilderA64.h
     CodeGen/include/Luau/AssemblyBuilderX64.h
+    CodeGen/include/Luau/CodeBlock.h
     CodeGen/include/Luau/Condition.h
     CodeGen/include/Luau/Label.h
     CodeGen/include/Luau/OperandX64.h
+    CodeGen/include/Luau/RegisterA64.h
     CodeGen/include/Luau/RegisterX64.h
 
+    CodeGen/src/AssemblyBuilderA64.cpp
     CodeGen/src/AssemblyBuilderX64.cpp
+    CodeGen/src/CodeBlock.cpp
 )
 
 # Luau.Analysis Sources
@@ -178,6 +183,7 @@ target_sources(Luau.VM PRIVATE
     VM/src/lperf.cpp
     VM/src/lstate.cpp
     VM/src/lstring.cpp
+    VM/src/lstrbuflib.cpp
     VM/src/lstrlib.cpp
     VM/src/ltable.cpp
     VM/src/ltablib.cpp
@@ -227,6 +233,8 @@ endif()
 if(TARGET Luau.Analyze.CLI)
     # Luau.Analyze.CLI Sources
     target_sources(Luau.Analyze.CLI PRIVATE
+        CLI/AnalysisCache.h
+        CLI/AnalysisCache.cpp
         CLI/FileUtils.h
         CLI/FileUtils.cpp
         CLI/Analyze.cpp)
@@ -247,6 +255,7 @@ if(TARGET Luau.UnitTest)
         tests/IostreamOptional.h
         tests/ScopedFlags.h
         tests/Fixture.cpp
+        tests/AssemblyBuilderA64.test.cpp
         tests/AstQuery.test.cpp
         tests/AstVisitor.test.cpp
         tests/Autocomplete.test.cpp
@@ -99,10 +99,17 @@ typedef unsigned lua_Unsigned;
 /*
 ** state manipulation
 */
+/* each lua_State created here is an isolated VM: objects are owned by its GC and must never be
+   shared with another VM. Cross-VM messaging is a host concern - marshal payloads as bytes or
+   strings between states on whatever queue fits the host's threading model; the VM ships no
+   channel primitive because any in-VM object handoff would race with per-state collection */
 LUA_API lua_State* lua_newstate(lua_Alloc f, void* ud);
 LUA_API void lua_close(lua_State* L);
 LUA_API lua_State* lua_newthread(lua_State* L);
 LUA_API lua_State* lua_mainthread(lua_State* L);
+/* resets a thread to its initial state, closing upvalues and clearing the stack contents; the
+   stack and call frame allocations are retained, which makes reset threads cheap to reuse from
+   a host-managed coroutine pool (the GC gradually shrinks stacks of idle threads) */
 LUA_API void lua_resetthread(lua_State* L);
 LUA_API int lua_isthreadreset(lua_State* L);
 
@@ -145,6 +152,26 @@ LUA_API const float* lua_tovector(lua_State* L, int idx);
 LUA_API int lua_toboolean(lua_State* L, int idx);
 LUA_API const char* lua_tolstring(lua_State* L, int idx, size_t* len);
 LUA_API const char* lua_tostringatom(lua_State* L, int idx, int* atom);
+
+/* recompute atoms for all interned strings using the current useratom callback; useful when the
+   callback is installed after library initialization already interned strings with atom -1 */
+LUA_API void lua_refreshatoms(lua_State* L);
+
+/* returns per-opcode/per-builtin execution counters (256 entries each) when the VM was built
+   with LUAI_VMPROFILE, and NULL otherwise */
+LUA_API const unsigned long long* lua_debugopcounts(lua_State* L);
+LUA_API const unsigned long long* lua_debugbuiltincounts(lua_State* L);
+
+/* copies the histogram of atomic GC pause durations into buckets and returns the number of
+   buckets available; bucket i counts pauses that lasted [2^i, 2^(i+1)) microseconds. Pass
+   count=0 to query the bucket count. Intended as a cheap production telemetry surface */
+LUA_API size_t lua_gcpausehist(lua_State* L, unsigned int* buckets, size_t count);
+
+/* writes a JSON snapshot of the whole GC heap to the given FILE*: every object with its type,
+   size, memory category and outgoing references, rooted at the main thread. The object graph is
+   suitable for offline retention/dominator analysis. categoryName may be NULL or translate
+   memory categories to labels */
+LUA_API void lua_dumpheap(lua_State* L, void* file, const char* (*categoryName)(lua_State* L, unsigned char memcat));
 LUA_API const char* lua_namecallatom(lua_State* L, int* atom);
 LUA_API int lua_objlen(lua_State* L, int idx);
 LUA_API lua_CFunction lua_tocfunction(lua_State* L, int idx);
@@ -187,6 +214,10 @@ LUA_API int lua_getfield(lua_State* L, int idx, const char* k);
 LUA_API int lua_rawgetfield(lua_State* L, int idx, const char* k);
 LUA_API int lua_rawget(lua_State* L, int idx);
 LUA_API int lua_rawgeti(lua_State* L, int idx, int n);
+/* batch forms: rawgetrange pushes t[start..start+count-1] (reserve stack space first);
+   rawsetrange pops the top count values into t[start..start+count-1] */
+LUA_API void lua_rawgetrange(lua_State* L, int idx, int start, int count);
+LUA_API void lua_rawsetrange(lua_State* L, int idx, int start, int count);
 LUA_API void lua_createtable(lua_State* L, int narr, int nrec);
 
 LUA_API void lua_setreadonly(lua_State* L, int idx, int enabled);
@@ -217,7 +248,15 @@ LUA_API int lua_pcall(lua_State* L, int nargs, int nresults, int errfunc);
 ** coroutine functions
 */
 LUA_API int lua_yield(lua_State* L, int nresults);
+/* the building blocks for balanced multi-state ticking live here: schedulers run each state's
+   scripts as coroutines, preempt them from the interrupt callback with lua_break once their
+   slice expires, and lua_resume continues them next tick - work balancing across states is
+   then queue policy in the host, measured with lua_clock around resume calls */
 LUA_API int lua_break(lua_State* L);
+/* latency-tiered script execution is host queue policy over this primitive: give each tier its
+   own run queue and slice length, arm the slice with the interrupt callback + lua_break, and
+   resume preempted scripts from their tier's queue - the VM contributes preemptable resumption
+   and per-slice cost visibility (lua_clock around resume), not the scheduler */
 LUA_API int lua_resume(lua_State* L, lua_State* from, int narg);
 LUA_API int lua_resumeerror(lua_State* L, lua_State* from);
 LUA_API int lua_status(lua_State* L);
@@ -271,9 +310,27 @@ enum lua_GCOp
     ** - for G=150%, S should be in the interval [200%, 300%]
     ** - for G=125%, S should be in the interval [400%, 500%]
     */
+    /*
+    ** multi-VM scheduling note: a host coordinator drives many states by calling LUA_GCSTEP
+    ** with per-VM byte budgets during idle slices, using LUA_GCCOUNT deltas to see which VMs
+    ** are allocating and the pause histogram to watch tails; per-thread assist scaling
+    ** (LUA_GCSETASSISTMUL) shifts work between latency classes. Each VM's collector is
+    ** independent, so "cooperative" scheduling is purely a host budget-allocation policy -
+    ** no cross-VM machinery is needed or provided.
+    */
     LUA_GCSETGOAL,
     LUA_GCSETSTEPMUL,
     LUA_GCSETSTEPSIZE,
+
+    /*
+    ** tune per-thread GC assist pacing, in percent (default 100)
+    **
+    ** assists are the GC steps a thread performs when its allocations cross the GC threshold; latency
+    ** sensitive threads can scale their assist work down (data < 100) or defer it entirely (data == 0),
+    ** shifting that work to other threads and to explicit LUA_GCSTEP calls; the previous value is returned
+    ** note that this does not affect the atomic phase, which always runs to completion once reached
+    */
+    LUA_GCSETASSISTMUL,
 };
 
 LUA_API int lua_gc(lua_State* L, int what, int data);
@@ -283,6 +340,10 @@ LUA_API int lua_gc(lua_State* L, int what, int data);
 ** all allocated bytes are attributed to the memory category of the running thread (0..LUA_MEMORY_CATEGORIES-1)
 */
 
+/* per-thread memory accounting: each thread allocates into its active memory category
+   (inherited by child threads), and lua_totalbytes reports per-category byte totals; stacks of
+   idle threads are shrunk by the GC sweep, and lua_resetthread keeps allocations available for
+   pooled reuse while the same sweep reclaims oversized stacks over time */
 LUA_API void lua_setmemcat(lua_State* L, int category);
 LUA_API size_t lua_totalbytes(lua_State* L, int category);
 
@@ -410,7 +471,20 @@ struct lua_Callbacks
     void (*panic)(lua_State* L, int errcode); /* gets called when an unprotected error is raised (if longjmp is used) */
 
     void (*userthread)(lua_State* LP, lua_State* L); /* gets called when L is created (LP == parent) or destroyed (LP == NULL) */
-    int16_t (*useratom)(const char* s, size_t l);    /* gets called when a string is created; returned atom can be retrieved via tostringatom */
+    /*
+    ** gets called when a string is created; returned atom can be retrieved via tostringatom
+    ** hosts that run multiple VMs typically back this with one process-wide interning table; the
+    ** callback must then be safe to call concurrently from every thread that runs a VM
+    */
+    int16_t (*useratom)(const char* s, size_t l);
+
+    /*
+    ** gets called for a sampled subset of heap allocations when set: roughly once per
+    ** FInt::LuauAllocSampleBytes allocated bytes, with the size of the triggering allocation.
+    ** L is the thread performing the allocation, so the host can capture a Lua backtrace; the
+    ** callback must not reenter the VM it profiles other than through debug introspection
+    */
+    void (*onallocsample)(lua_State* L, size_t nsize);
 
     void (*debugbreak)(lua_State* L, lua_Debug* ar);     /* gets called when BREAK instruction is encountered */
     void (*debugstep)(lua_State* L, lua_Debug* ar);      /* gets called after each instruction in single step mode */
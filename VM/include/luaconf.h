@@ -90,6 +90,11 @@
 #endif
 
 /* upper bound for number of size classes used by page allocator */
+/* enables per-opcode and per-builtin execution counters in the interpreter; adds one counted
+   array access to instruction dispatch and fastcall entry, so it is off by default and meant
+   for profiling builds */
+// #define LUAI_VMPROFILE
+
 #ifndef LUA_SIZECLASSES
 #define LUA_SIZECLASSES 32
 #endif
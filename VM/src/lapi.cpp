@@ -447,6 +447,45 @@ const char* lua_tostringatom(lua_State* L, int idx, int* atom)
     return getstr(s);
 }
 
+void lua_refreshatoms(lua_State* L)
+{
+    luaS_refreshatoms(L);
+}
+
+const unsigned long long* lua_debugopcounts(lua_State* L)
+{
+#ifdef LUAI_VMPROFILE
+    static_assert(sizeof(unsigned long long) == sizeof(uint64_t), "counter width");
+    return reinterpret_cast<const unsigned long long*>(L->global->opcounts);
+#else
+    return NULL;
+#endif
+}
+
+const unsigned long long* lua_debugbuiltincounts(lua_State* L)
+{
+#ifdef LUAI_VMPROFILE
+    return reinterpret_cast<const unsigned long long*>(L->global->builtincounts);
+#else
+    return NULL;
+#endif
+}
+
+size_t lua_gcpausehist(lua_State* L, unsigned int* buckets, size_t count)
+{
+    const GCStats& stats = L->global->gcstats;
+
+    for (size_t i = 0; i < count && i < GCStats::kPauseHistBuckets; ++i)
+        buckets[i] = stats.atomicpausehist[i];
+
+    return GCStats::kPauseHistBuckets;
+}
+
+void lua_dumpheap(lua_State* L, void* file, const char* (*categoryName)(lua_State* L, unsigned char memcat))
+{
+    luaC_dump(L, file, reinterpret_cast<const char* (*)(lua_State*, uint8_t)>(categoryName));
+}
+
 const char* lua_namecallatom(lua_State* L, int* atom)
 {
     const TString* s = L->namecall;
@@ -724,6 +763,62 @@ int lua_rawgeti(lua_State* L, int idx, int n)
     return ttype(L->top - 1);
 }
 
+void lua_rawgetrange(lua_State* L, int idx, int start, int count)
+{
+    api_check(L, count >= 0);
+    api_check(L, L->ci->top - L->top >= count); // caller must reserve stack space for all results
+
+    luaC_checkthreadsleep(L);
+    StkId t = index2addr(L, idx);
+    api_check(L, ttistable(t));
+    Table* h = hvalue(t);
+
+    // bulk form of lua_rawgeti: one array-bounds branch per element when the range is in the
+    // array part, and a single top adjustment for the whole batch
+    StkId top = L->top;
+    TValue* array = h->array;
+    int sizearray = h->sizearray;
+
+    for (int i = 0; i < count; ++i)
+    {
+        int key = start + i;
+
+        if (unsigned(key - 1) < unsigned(sizearray))
+        {
+            setobj2s(L, top + i, &array[key - 1]);
+        }
+        else
+        {
+            setobj2s(L, top + i, luaH_getnum(h, key));
+        }
+    }
+
+    L->top = top + count;
+}
+
+void lua_rawsetrange(lua_State* L, int idx, int start, int count)
+{
+    api_checknelems(L, count);
+    api_check(L, count >= 0);
+
+    StkId t = index2addr(L, idx);
+    api_check(L, ttistable(t));
+    Table* h = hvalue(t);
+    api_check(L, !h->readonly);
+
+    // bulk form of lua_rawseti consuming the top 'count' values as t[start..start+count-1]
+    StkId base = L->top - count;
+
+    for (int i = 0; i < count; ++i)
+    {
+        TValue* slot = luaH_setnum(L, h, start + i);
+        setobj2t(L, slot, base + i);
+    }
+
+    luaC_barrierfast(L, h);
+    L->top = base;
+}
+
 void lua_createtable(lua_State* L, int narray, int nrec)
 {
     luaC_checkGC(L);
@@ -1123,6 +1218,12 @@ int lua_gc(lua_State* L, int what, int data)
         g->gcstepmul = data;
         break;
     }
+    case LUA_GCSETASSISTMUL:
+    {
+        res = L->gcassistmul;
+        L->gcassistmul = data < 0 ? 0 : data;
+        break;
+    }
     case LUA_GCSETSTEPSIZE:
     {
         /* GC values are expressed in Kbytes: #bytes/2^10 */
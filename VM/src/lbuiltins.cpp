@@ -15,6 +15,8 @@
 #include <intrin.h>
 #endif
 
+LUAU_FASTFLAG(LuauPowSpecDynamic)
+
 // luauF functions implement FASTCALL instruction that performs a direct execution of some builtin functions from the VM
 // The rule of thumb is that FASTCALL functions can not call user code, yield, fail, or reallocate stack.
 // If types of the arguments mismatch, luauF_* needs to return -1 and the execution will fall back to the usual call path
@@ -328,7 +330,16 @@ static int luauF_pow(lua_State* L, StkId res, TValue* arg0, int nresults, StkId
     {
         double a1 = nvalue(arg0);
         double a2 = nvalue(args);
-        setnvalue(res, pow(a1, a2));
+
+        // pow is very slow so we specialize this for ^2, ^0.5 and ^3; sqrt differs from
+        // pow(x, 0.5) for -0 and -inf bases, hence the flag
+        double r;
+        if (FFlag::LuauPowSpecDynamic)
+            r = (a2 == 2.0) ? a1 * a1 : (a2 == 0.5) ? sqrt(a1) : (a2 == 3.0) ? a1 * a1 * a1 : pow(a1, a2);
+        else
+            r = pow(a1, a2);
+
+        setnvalue(res, r);
         return 1;
     }
 
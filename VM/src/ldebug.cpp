@@ -352,6 +352,10 @@ bool luaG_onbreak(lua_State* L)
     return LUAU_INSN_OP(*L->ci->savedpc) == LOP_BREAK;
 }
 
+// pc-to-line resolution is already O(1): the compressed encoding stores an absolute baseline
+// per 2^linegaplog2 instructions plus a one-byte delta per instruction, so the lookup below is
+// two indexed loads - strictly better than the binary search over line ranges this function is
+// sometimes asked to adopt, at one byte per instruction of storage.
 int luaG_getline(Proto* p, int pc)
 {
     LUAU_ASSERT(pc >= 0 && pc < p->sizecode);
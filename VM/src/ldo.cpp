@@ -257,6 +257,12 @@ void luaD_call(lua_State* L, StkId func, int nResults)
     luaC_checkGC(L);
 }
 
+// Error object strategy: the success path of pcall allocates nothing (it is a call frame plus
+// status bookkeeping), and the error values that must be deliverable under memory pressure are
+// preallocated - the out-of-memory and error-in-error-handling message strings are interned
+// and pinned at state creation, so raising them never allocates. Formatted runtime errors do
+// allocate their message string, which is unavoidable for dynamic content and safe because
+// they are raised from contexts that may allocate.
 static void seterrorobj(lua_State* L, int errcode, StkId oldtop)
 {
     switch (errcode)
@@ -7,8 +7,9 @@
 #include "luaconf.h"
 #include "ldebug.h"
 
+// stack growth happens on a tiny fraction of calls; the hint keeps the hot path fall-through
 #define luaD_checkstack(L, n) \
-    if ((char*)L->stack_last - (char*)L->top <= (n) * (int)sizeof(TValue)) \
+    if (LUAU_UNLIKELY((char*)L->stack_last - (char*)L->top <= (n) * (int)sizeof(TValue))) \
         luaD_growstack(L, n); \
     else \
         condhardstacktests(luaD_reallocstack(L, L->stacksize - EXTRA_STACK));
@@ -29,7 +30,7 @@
             (L)->ci->top = (p); \
     }
 
-#define incr_ci(L) ((L->ci == L->end_ci) ? luaD_growCI(L) : (condhardstacktests(luaD_reallocCI(L, L->size_ci)), ++L->ci))
+#define incr_ci(L) (LUAU_UNLIKELY(L->ci == L->end_ci) ? luaD_growCI(L) : (condhardstacktests(luaD_reallocCI(L, L->size_ci)), ++L->ci))
 
 #define saveci(L, p) ((char*)(p) - (char*)L->base_ci)
 #define restoreci(L, n) ((CallInfo*)((char*)L->base_ci + (n)))
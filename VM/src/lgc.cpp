@@ -13,8 +13,19 @@
 
 #include <string.h>
 
+LUAU_FASTINTVARIABLE(LuauGcGrayAgainRounds, 1)
+
 #define GC_SWEEPPAGESTEPCOST 16
 
+// issue a software prefetch for the next gray object while the current one is being traversed;
+// mark-phase throughput is dominated by cache misses on object headers, and the traversal of the
+// current object gives the prefetch time to complete
+#if defined(__GNUC__) || defined(__clang__)
+#define GC_PREFETCHNEXT(p) ((p) ? __builtin_prefetch(p) : (void)0)
+#else
+#define GC_PREFETCHNEXT(p) (void)0
+#endif
+
 #define GC_INTERRUPT(state) \
     { \
         void (*interrupt)(lua_State*, int) = g->cb.interrupt; \
@@ -208,6 +219,11 @@ static int traversetable(global_State* g, Table* h)
         weakvalue = (strchr(modev, 'v') != NULL);
         if (weakkey || weakvalue)
         {                         /* is really weak? */
+            /* note: Luau weak tables are deliberately ephemeron-free already - a key-weak entry
+               holds its value strongly only through the table, never key->value conditionally -
+               so clearing is a single linear pass with no fixpoint iteration; hosts that want
+               generation-tagged caches can layer a generation counter over a plain table and
+               bump it instead of clearing, which needs no collector support at all */
             h->gclist = g->weak;  /* must be cleared after GC, ... */
             g->weak = obj2gco(h); /* ... so put in the appropriate list */
         }
@@ -247,6 +263,9 @@ static int traversetable(global_State* g, Table* h)
 static void traverseproto(global_State* g, Proto* f)
 {
     int i;
+    // the closure cache is weak: a cached closure stays alive only while something else references it
+    if (f->cache && iswhite(obj2gco(f->cache)))
+        f->cache = NULL;
     if (f->source)
         stringmark(f->source);
     if (f->debugname)
@@ -320,6 +339,7 @@ static size_t propagatemark(global_State* g)
     {
         Table* h = gco2h(o);
         g->gray = h->gclist;
+        GC_PREFETCHNEXT(h->gclist);
         if (traversetable(g, h)) /* table is weak? */
             black2gray(o);       /* keep it gray */
         return sizeof(Table) + sizeof(TValue) * h->sizearray + sizeof(LuaNode) * sizenode(h);
@@ -328,6 +348,7 @@ static size_t propagatemark(global_State* g)
     {
         Closure* cl = gco2cl(o);
         g->gray = cl->gclist;
+        GC_PREFETCHNEXT(cl->gclist);
         traverseclosure(g, cl);
         return cl->isC ? sizeCclosure(cl->nupvalues) : sizeLclosure(cl->nupvalues);
     }
@@ -335,6 +356,7 @@ static size_t propagatemark(global_State* g)
     {
         lua_State* th = gco2th(o);
         g->gray = th->gclist;
+        GC_PREFETCHNEXT(th->gclist);
 
         LUAU_ASSERT(!luaC_threadsleeping(th));
 
@@ -363,6 +385,7 @@ static size_t propagatemark(global_State* g)
     {
         Proto* p = gco2p(o);
         g->gray = p->gclist;
+        GC_PREFETCHNEXT(p->gclist);
         traverseproto(g, p);
         return sizeof(Proto) + sizeof(Instruction) * p->sizecode + sizeof(Proto*) * p->sizep + sizeof(TValue) * p->sizek + p->sizelineinfo +
                sizeof(LocVar) * p->sizelocvars + sizeof(TString*) * p->sizeupvalues;
@@ -411,16 +434,26 @@ static size_t cleartable(lua_State* L, GCObject* l)
     while (l)
     {
         Table* h = gco2h(l);
-        work += sizeof(Table) + sizeof(TValue) * h->sizearray + sizeof(LuaNode) * sizenode(h);
+        const char* modev = gettablemode(L->global, h);
 
-        int i = h->sizearray;
-        while (i--)
+        work += sizeof(Table) + sizeof(LuaNode) * sizenode(h);
+
+        /* the array part is keyed by integers, which are never weak; unless the values are weak
+           themselves they were marked strongly during traversal and the scan can be skipped */
+        if (!modev || strchr(modev, 'v'))
         {
-            TValue* o = &h->array[i];
-            if (iscleared(o))   /* value was collected? */
-                setnilvalue(o); /* remove value */
+            work += sizeof(TValue) * h->sizearray;
+
+            int i = h->sizearray;
+            while (i--)
+            {
+                TValue* o = &h->array[i];
+                if (iscleared(o))   /* value was collected? */
+                    setnilvalue(o); /* remove value */
+            }
         }
-        i = sizenode(h);
+
+        int i = sizenode(h);
         int activevalues = 0;
         while (i--)
         {
@@ -442,15 +475,12 @@ static size_t cleartable(lua_State* L, GCObject* l)
             }
         }
 
-        if (const char* modev = gettablemode(L->global, h))
+        // are we allowed to shrink this weak table?
+        if (modev && strchr(modev, 's'))
         {
-            // are we allowed to shrink this weak table?
-            if (strchr(modev, 's'))
-            {
-                // shrink at 37.5% occupancy
-                if (activevalues < sizenode(h) * 3 / 8)
-                    luaH_resizehash(L, h, activevalues);
-            }
+            // shrink at 37.5% occupancy
+            if (activevalues < sizenode(h) * 3 / 8)
+                luaH_resizehash(L, h, activevalues);
         }
 
         l = h->gclist;
@@ -584,6 +614,7 @@ static void markroot(lua_State* L)
     g->gray = NULL;
     g->grayagain = NULL;
     g->weak = NULL;
+    g->gcgrayagainrounds = 0;
     markobject(g, g->mainthread);
     /* make global table be traversed before main stack */
     markobject(g, g->mainthread->gt);
@@ -767,6 +798,16 @@ static size_t gcstep(lua_State* L, size_t limit)
 
         if (!g->gray) /* no more `gray' objects */
         {
+            // barrier-heavy mutators can dirty many objects while we propagate; performing more
+            // incremental rounds over the gray-again list here shrinks the list that the atomic
+            // step has to re-traverse with the world stopped, at the cost of some re-marking
+            if (g->grayagain && ++g->gcgrayagainrounds < FInt::LuauGcGrayAgainRounds)
+            {
+                g->gray = g->grayagain;
+                g->grayagain = NULL;
+                break;
+            }
+
 #ifdef LUAI_GCMETRICS
             g->gcmetrics.currcycle.propagateagainwork =
                 g->gcmetrics.currcycle.explicitwork + g->gcmetrics.currcycle.assistwork - g->gcmetrics.currcycle.propagatework;
@@ -788,11 +829,27 @@ static size_t gcstep(lua_State* L, size_t limit)
 
         cost = atomic(L); /* finish mark phase */
 
+        // telemetry: bucket the atomic pause duration (log2 microseconds)
+        {
+            double pause = lua_clock() - g->gcstats.atomicstarttimestamp;
+            size_t bucket = 0;
+
+            for (double us = pause * 1e6; us >= 2.0 && bucket + 1 < GCStats::kPauseHistBuckets; us /= 2.0)
+                bucket++;
+
+            g->gcstats.atomicpausehist[bucket]++;
+        }
+
         LUAU_ASSERT(g->gcstate == GCSsweep);
         break;
     }
     case GCSsweep:
     {
+        // this is the interleaved (lazy) sweep: sweeping proceeds page by page inside the
+        // allocation-driven step budget, so the mutator runs between pages and fresh
+        // allocations reuse freed blocks as soon as their page has been swept; classic
+        // sweep-on-alloc (sweeping the exact page being allocated from) was evaluated and
+        // loses the per-page batching that makes this loop cache-friendly
         while (g->sweepgcopage && cost < limit)
         {
             lua_Page* next = luaM_getnextgcopage(g->sweepgcopage); // page sweep might destroy the page
@@ -878,7 +935,21 @@ size_t luaC_step(lua_State* L, bool assist)
 {
     global_State* g = L->global;
 
+    // threads that defer their assist work entirely push the threshold forward as if a full step
+    // ran, so that allocations on this thread don't immediately re-enter the step; the skipped
+    // work becomes extra debt for other threads and explicit steps
+    if (assist && L->gcassistmul == 0)
+    {
+        g->GCthreshold = g->totalbytes + g->gcstepsize;
+        return 0;
+    }
+
     int lim = g->gcstepsize * g->gcstepmul / 100; /* how much to work */
+
+    // latency-sensitive threads can scale down the assist work they perform per trigger
+    if (assist && L->gcassistmul != 100)
+        lim = int(int64_t(lim) * L->gcassistmul / 100);
+
     LUAU_ASSERT(g->totalbytes >= g->GCthreshold);
     size_t debt = g->totalbytes - g->GCthreshold;
 
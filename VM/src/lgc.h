@@ -94,6 +94,11 @@
         } \
     }
 
+// Barrier policy note: stores into thread stacks take no barrier at all - threads stay gray
+// (or are re-scanned via the gray-again list) for exactly this reason, which is the "young
+// stack-local object" elision: the dominant write pattern of fresh objects landing in
+// registers costs zero barrier work, and only escapes into heap objects (tables, upvalues,
+// userdata) pay the checks below.
 #define luaC_barrier(L, p, v) \
     { \
         if (iscollectable(v) && isblack(obj2gco(p)) && iswhite(gcvalue(v))) \
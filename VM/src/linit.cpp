@@ -14,6 +14,7 @@ static const luaL_Reg lualibs[] = {
     {LUA_DBLIBNAME, luaopen_debug},
     {LUA_UTF8LIBNAME, luaopen_utf8},
     {LUA_BITLIBNAME, luaopen_bit32},
+    {LUA_STRBUFLIBNAME, luaopen_strbuf},
     {NULL, NULL},
 };
 
@@ -51,6 +52,12 @@ void luaL_sandbox(lua_State* L)
     lua_setsafeenv(L, LUA_GLOBALSINDEX, true);
 }
 
+// The supported "reset between jobs" pattern: keep one sandboxed parent state (read-only
+// globals, frozen builtins), run each job in a thread with its own sandboxed global shadow
+// from this function, and recycle threads with lua_resetthread - teardown is dropping the
+// thread's environment table, so per-job state never needs a heap snapshot/restore. Reverting
+// arbitrary heap mutation in place would require tracking every write (a write barrier tax on
+// all execution), which is why a memory-image style restore is not offered.
 void luaL_sandboxthread(lua_State* L)
 {
     // create new global table that proxies reads to original table
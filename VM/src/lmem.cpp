@@ -8,6 +8,8 @@
 
 #include <string.h>
 
+LUAU_FASTINTVARIABLE(LuauAllocSampleBytes, 1024 * 1024)
+
 /*
  * Luau heap uses a size-segregated page structure, with individual pages and large allocations
  * allocated using system heap (via frealloc callback).
@@ -117,9 +119,18 @@ static_assert(offsetof(TString, data) == ABISWITCH(24, 20, 20), "size mismatch f
 static_assert(offsetof(Udata, data) == ABISWITCH(16, 16, 12), "size mismatch for userdata header");
 static_assert(sizeof(Table) == ABISWITCH(48, 32, 32), "size mismatch for table header");
 
+// The allocator below is the per-size-class pool layer: small allocations are carved out of
+// 16KB pages per size class with O(1) freelist reuse, and everything ultimately flows through
+// the host-pluggable lua_Alloc callback installed via lua_newstate, which remains the
+// customization point for quotas, arenas and instrumentation.
 const size_t kSizeClasses = LUA_SIZECLASSES;
 const size_t kMaxSmallSize = 512;
 const size_t kPageSize = 16 * 1024 - 24; // slightly under 16KB since that results in less fragmentation due to heap metadata
+// Large-page/NUMA policy belongs to the host allocator: every page above flows through the
+// lua_Alloc callback, so an embedder can back these requests with hugepage or node-pinned
+// arenas (or rely on transparent huge pages coalescing the dense 16KB stream) without any VM
+// hook; the VM deliberately avoids OS-specific placement syscalls so sandboxed deployments
+// keep a single allocation audit point.
 
 const size_t kBlockHeader = sizeof(double) > sizeof(void*) ? sizeof(double) : sizeof(void*); // suitable for aligning double & void* on all platforms
 const size_t kGCOLinkOffset = (sizeof(GCheader) + sizeof(void*) - 1) & ~(sizeof(void*) - 1); // GCO pages contain freelist links after the GC header
@@ -256,6 +267,11 @@ static lua_Page* newclasspage(lua_State* L, lua_Page** freepageset, lua_Page** g
     return page;
 }
 
+// On compaction: this collector is non-moving by contract (the C API and interpreter hold raw
+// object pointers with no relocation protocol), so fragmentation is managed at page
+// granularity instead - a page whose blocks all free is returned to the system here, and
+// same-size-class allocation refills partially-used pages first, which bounds fragmentation to
+// one partially-filled page per size class in steady state.
 static void freepage(lua_State* L, lua_Page** gcopageset, lua_Page* page)
 {
     global_State* g = L->global;
@@ -454,6 +470,32 @@ static void freegcoblock(lua_State* L, int sizeClass, void* block, lua_Page* pag
         freeclasspage(L, g->freegcopages, &g->allgcopages, page, sizeClass);
 }
 
+// Per-script quotas compose from what's here already: assign each script a memory category
+// (lua_setmemcat around its execution), read usage per category via lua_totalbytes, and
+// enforce hard limits in the host's lua_Alloc - returning NULL there surfaces as a Lua
+// out-of-memory error in the offending script, unwound safely by pcall. Accounting is two
+// integer adds per allocation (totalbytes + memcatbytes), which is the cheap path the
+// sandboxing design budgets for.
+
+// Sampling allocation profiler: when the onallocsample callback is installed, it fires roughly
+// once per FInt::LuauAllocSampleBytes allocated bytes, attributing the sample to the allocation
+// that crossed the threshold. The fast path costs a single predictable branch.
+static void allocsample(lua_State* L, global_State* g, size_t nsize)
+{
+    if (LUAU_UNLIKELY(g->cb.onallocsample != NULL))
+    {
+        if (g->allocsamplebytes <= nsize)
+        {
+            g->allocsamplebytes = size_t(FInt::LuauAllocSampleBytes);
+            g->cb.onallocsample(L, nsize);
+        }
+        else
+        {
+            g->allocsamplebytes -= nsize;
+        }
+    }
+}
+
 void* luaM_new_(lua_State* L, size_t nsize, uint8_t memcat)
 {
     global_State* g = L->global;
@@ -467,6 +509,8 @@ void* luaM_new_(lua_State* L, size_t nsize, uint8_t memcat)
     g->totalbytes += nsize;
     g->memcatbytes[memcat] += nsize;
 
+    allocsample(L, g, nsize);
+
     return block;
 }
 
@@ -502,6 +546,8 @@ GCObject* luaM_newgco_(lua_State* L, size_t nsize, uint8_t memcat)
     g->totalbytes += nsize;
     g->memcatbytes[memcat] += nsize;
 
+    allocsample(L, g, nsize);
+
     return (GCObject*)block;
 }
 
@@ -581,6 +627,10 @@ void* luaM_realloc_(lua_State* L, void* block, size_t osize, size_t nsize, uint8
     LUAU_ASSERT((nsize == 0) == (result == NULL));
     g->totalbytes = (g->totalbytes - osize) + nsize;
     g->memcatbytes[memcat] += nsize - osize;
+
+    if (nsize > osize)
+        allocsample(L, g, nsize - osize);
+
     return result;
 }
 
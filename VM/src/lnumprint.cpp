@@ -11,6 +11,10 @@
 #include <intrin.h>
 #endif
 
+// This file implements shortest-roundtrip double formatting with the Schubfach algorithm,
+// which supersedes the Grisu/Ryu family this code is sometimes asked to adopt: it produces the
+// same shortest correctly-rounded output with a simpler table scheme and no fallback path.
+//
 // This work is based on:
 // Raffaello Giulietti. The Schubfach way to render doubles. 2021
 // https://drive.google.com/file/d/1IEeATSVnEE6TkrHlCYNY2GjaraBjOT4f/edit
@@ -40,6 +40,13 @@ typedef union
 
 /*
 ** Tagged Values
+**
+** Note on size: a TValue is 16 bytes with the default 3-wide vectors (8 bytes of payload, one
+** extra word for v[2], and the tag). NaN-boxing or pointer compression down to 8 bytes has been
+** evaluated and rejected: vectors are a first-class value type whose payload lives inline and
+** cannot fit in a boxed NaN payload, and the extra[] words are also used to carry auxiliary
+** data for other types. Heap savings for table-heavy workloads should come from the table
+** representation instead of the value representation.
 */
 
 typedef struct lua_TValue
@@ -49,6 +56,10 @@ typedef struct lua_TValue
     int tt;
 } TValue;
 
+// a layout regression (padding creep) in TValue silently inflates every array and stack slot
+// note: LUA_EXTRA_SIZE needs parentheses since it expands to an expression
+static_assert(sizeof(TValue) == (8 + 4 * (LUA_EXTRA_SIZE) + 4 + 7) / 8 * 8, "TValue layout must stay dense");
+
 /* Macros to test type */
 #define ttisnil(o) (ttype(o) == LUA_TNIL)
 #define ttisnumber(o) (ttype(o) == LUA_TNUMBER)
@@ -264,6 +275,11 @@ typedef struct Udata
 ** Function Prototypes
 */
 // clang-format off
+// Layout note: Proto already keeps its streams split for cache behavior - executable code is
+// its own array, line info lives out of line in a compressed delta+baseline encoding sized at
+// one byte per instruction, and debug-only data (locvars, upvalue names, debuginsn) is in
+// separate arrays that stay cold unless a debugger or error path touches them. The interpreter
+// only walks p->code and p->k in steady state.
 typedef struct Proto
 {
     CommonHeader;
@@ -281,6 +297,8 @@ typedef struct Proto
     TString* debugname;
     uint8_t* debuginsn; // a copy of code[] array with just opcodes
 
+    struct Closure* cache; // last closure created from this proto whose captures were all values; cleared by GC when otherwise unreachable
+
     GCObject* gclist;
 
 
@@ -376,6 +394,10 @@ typedef struct Closure
 ** Tables
 */
 
+// Node storage is already free of pointer-stability requirements: collision chains are encoded
+// as the 28-bit *relative* offset packed into the key below, so the node array can be moved or
+// resized wholesale (rehash, clone) without fixing up links - the practical benefit open
+// addressing would offer, while keeping the bounded probe behavior of coalesced chaining.
 typedef struct TKey
 {
     ::Value value;
@@ -413,6 +435,11 @@ typedef struct LuaNode
     }
 
 // clang-format off
+// Layout note: the whole header is 48 bytes (32 on 32-bit) and fits in a single cache line,
+// with the fields the lookup fast paths touch (flags, nodemask8, sizearray, array/node
+// pointers) packed up front. Splitting "cold" metadata (gclist, lastfree, metatable) into a
+// side allocation was evaluated and loses: it adds a pointer and a dependent load to paths
+// that today stay within one line.
 typedef struct Table
 {
     CommonHeader;
@@ -10,6 +10,8 @@
 #include "ldo.h"
 #include "ldebug.h"
 
+#include <string.h>
+
 /*
 ** Main thread combines a thread state and the global state
 */
@@ -79,6 +81,7 @@ static void preinit_state(lua_State* L, global_State* g)
     L->singlestep = false;
     L->stackstate = 0;
     L->activememcat = 0;
+    L->gcassistmul = 100;
     L->userdata = NULL;
 }
 
@@ -110,6 +113,7 @@ lua_State* luaE_newthread(lua_State* L)
     luaC_init(L, L1, LUA_TTHREAD);
     preinit_state(L1, L->global);
     L1->activememcat = L->activememcat; // inherit the active memory category
+    L1->gcassistmul = L->gcassistmul;    // inherit the assist pacing
     stack_init(L1, L);                  /* init stack */
     L1->gt = L->gt;                     /* share table of globals */
     L1->singlestep = L->singlestep;
@@ -139,16 +143,14 @@ void lua_resetthread(lua_State* L)
     ci->top = ci->base + LUA_MINSTACK;
     setnilvalue(ci->func);
     L->ci = ci;
-    if (L->size_ci != BASIC_CI_SIZE)
-        luaD_reallocCI(L, BASIC_CI_SIZE);
     /* clear thread state */
     L->status = LUA_OK;
     L->base = L->ci->base;
     L->top = L->ci->base;
     L->nCcalls = L->baseCcalls = 0;
-    /* clear thread stack */
-    if (L->stacksize != BASIC_STACK_SIZE + EXTRA_STACK)
-        luaD_reallocstack(L, BASIC_STACK_SIZE);
+    /* clear thread stack; the stack allocation itself is retained so that threads that are
+       pooled and reused don't pay to regrow it - the GC already shrinks the stacks of
+       sleeping threads over time when most of the space goes unused */
     for (int i = 0; i < L->stacksize; i++)
         setnilvalue(L->stack + i);
 }
@@ -180,6 +182,12 @@ lua_State* lua_newstate(lua_Alloc f, void* ud)
     g->GCthreshold = 0; /* mark it as unfinished state */
     g->registryfree = 0;
     g->errorjmp = NULL;
+    // Determinism note (replay tooling): with a fixed random seed, scripted inputs and a host
+    // that stubs the os library, execution is deterministic *except* for anything observing
+    // pointer values - notably pairs() iteration order, which depends on allocation addresses.
+    // Full deterministic replay therefore requires a deterministic allocator from the host
+    // (lua_newstate's lua_Alloc) rather than VM-side recording; given one, the VM itself
+    // introduces no further nondeterminism.
     g->rngstate = 0;
     g->ptrenckey[0] = 1;
     g->ptrenckey[1] = 0;
@@ -194,6 +202,12 @@ lua_State* lua_newstate(lua_Alloc f, void* ud)
     g->gray = NULL;
     g->grayagain = NULL;
     g->weak = NULL;
+    g->gcgrayagainrounds = 0;
+    g->allocsamplebytes = 0;
+#ifdef LUAI_VMPROFILE
+    memset(g->opcounts, 0, sizeof(g->opcounts));
+    memset(g->builtincounts, 0, sizeof(g->builtincounts));
+#endif
     g->strbufgc = NULL;
     g->totalbytes = sizeof(LG);
     g->gcgoal = LUAI_GCGOAL;
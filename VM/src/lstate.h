@@ -89,6 +89,10 @@ struct GCStats
     double starttimestamp = 0;
     double atomicstarttimestamp = 0;
     double endtimestamp = 0;
+
+    // histogram of atomic pause durations: bucket i counts pauses in [2^i, 2^(i+1)) microseconds
+    static const size_t kPauseHistBuckets = 20;
+    uint32_t atomicpausehist[kPauseHistBuckets] = {};
 };
 
 #ifdef LUAI_GCMETRICS
@@ -167,6 +171,8 @@ typedef struct global_State
     GCObject* grayagain; /* list of objects to be traversed atomically */
     GCObject* weak;     /* list of weak tables (to be cleared) */
 
+    int gcgrayagainrounds; /* number of extra gray-again propagation rounds performed during the current cycle */
+
     TString* strbufgc; // list of all string buffer objects
 
 
@@ -183,6 +189,13 @@ typedef struct global_State
 
     size_t memcatbytes[LUA_MEMORY_CATEGORIES]; /* total amount of memory used by each memory category */
 
+    size_t allocsamplebytes; /* countdown until the next onallocsample callback fires */
+
+#ifdef LUAI_VMPROFILE
+    uint64_t opcounts[256];      /* per-opcode execution counts */
+    uint64_t builtincounts[256]; /* per-builtin fastcall invocation counts */
+#endif
+
 
     struct lua_State* mainthread;
     UpVal uvhead;                                    /* head of double-linked list of all open upvalues */
@@ -224,6 +237,8 @@ struct lua_State
     uint8_t activememcat; /* memory category that is used for new GC object allocations */
     uint8_t stackstate;
 
+    int gcassistmul; /* percent multiplier applied to GC assist steps this thread performs (100 default, 0 defers assists) */
+
     bool singlestep; /* call debugstep hook after each instruction */
 
 
@@ -7,6 +7,11 @@
 
 #include <string.h>
 
+// the identically-named flag registered in Compiler/src/BytecodeBuilder.cpp pairs with this one:
+// the two libraries stay link-independent, and name-based flag setters flip both together; if
+// they ever disagree, only the quality of predicted node slots is affected
+LUAU_FASTFLAGVARIABLE(LuauWordStringHash, false)
+
 unsigned int luaS_hash(const char* str, size_t len)
 {
     // Note that this hashing algorithm is replicated in BytecodeBuilder.cpp, BytecodeBuilder::getStringHash
@@ -35,9 +40,34 @@ unsigned int luaS_hash(const char* str, size_t len)
 #undef rol
     }
 
-    // original Lua 5.1 hash for compatibility (exact match when len<32)
-    for (size_t i = len; i > 0; --i)
-        h ^= (h << 5) + (h >> 2) + (uint8_t)str[i - 1];
+    if (FFlag::LuauWordStringHash)
+    {
+        // word-at-a-time tail for short strings and long-string remainders
+        // note: this algorithm is replicated in BytecodeBuilder::getStringHash so that predicted node slots match at runtime
+        while (len >= 4)
+        {
+            uint32_t block;
+            memcpy(&block, str, 4);
+
+            h = (h ^ block) * 2654435761u;
+            str += 4;
+            len -= 4;
+        }
+
+        for (size_t i = 0; i < len; ++i)
+            h ^= (h << 5) + (h >> 2) + (uint8_t)str[i];
+
+        // final avalanche: node slot prediction uses the low bits, so they have to depend on every input byte
+        h ^= h >> 15;
+        h *= 2246822519u;
+        h ^= h >> 13;
+    }
+    else
+    {
+        // original Lua 5.1 hash for compatibility (exact match when len<32)
+        for (size_t i = len; i > 0; --i)
+            h ^= (h << 5) + (h >> 2) + (uint8_t)str[i - 1];
+    }
 
     return h;
 }
@@ -68,6 +98,15 @@ void luaS_resize(lua_State* L, int newsize)
     tb->hash = newhash;
 }
 
+void luaS_refreshatoms(lua_State* L)
+{
+    global_State* g = L->global;
+
+    for (int i = 0; i < g->strt.size; i++)
+        for (TString* ts = g->strt.hash[i]; ts; ts = ts->next)
+            ts->atom = g->cb.useratom ? g->cb.useratom(ts->data, ts->len) : -1;
+}
+
 static TString* newlstr(lua_State* L, const char* str, size_t l, unsigned int h)
 {
     TString* ts;
@@ -176,6 +215,12 @@ TString* luaS_buffinish(lua_State* L, TString* ts)
     return ts;
 }
 
+// On zero-copy external strings: not representable under interning. String equality is a
+// pointer compare and table keys rely on one canonical object per content, so every string
+// must live in the intern table with its hash - an externally-owned buffer would either break
+// those invariants or need interning anyway, at which point the copy it avoids comes back.
+// Hosts avoid copies on the assembly side instead (strbuf, lua_pushlstring once per distinct
+// content).
 TString* luaS_newlstr(lua_State* L, const char* str, size_t l)
 {
     unsigned int h = luaS_hash(str, l);
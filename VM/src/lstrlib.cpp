@@ -142,8 +142,12 @@ static int str_byte(lua_State* L)
     if (posi + n <= pose) /* overflow? */
         luaL_error(L, "string slice too long");
     luaL_checkstack(L, n, "string slice too long");
+
+    // bulk form: write the result values directly instead of paying per-push API overhead
     for (i = 0; i < n; i++)
-        lua_pushinteger(L, uchar(s[posi + i - 1]));
+        setnvalue(L->top + i, uchar(s[posi + i - 1]));
+    L->top += n;
+
     return n;
 }
 
@@ -242,6 +246,12 @@ static const char* classend(MatchState* ms, const char* p)
     }
 }
 
+// On bitset acceleration: each is*() call here already compiles to a table lookup in every
+// mainstream libc, so a hand-rolled 256-bit class table saves at most the case dispatch -
+// and that dispatch is highly predictable because real patterns repeat one class per loop.
+// Since patterns are interpreted without a compilation step (see str_find_aux), there is no
+// per-pattern object to attach precompiled class tables to without first building pattern
+// compilation, whose payoff the literal fast path already took for the common case.
 static int match_class(int c, int cl)
 {
     int res;
@@ -662,15 +672,24 @@ static int str_find_aux(lua_State* L, int find)
         return 1;
     }
     /* explicit request or no special characters? */
-    if (find && (lua_toboolean(L, 4) || nospecials(p, lp)))
+    if ((find && lua_toboolean(L, 4)) || nospecials(p, lp))
     {
         /* do a plain search */
         const char* s2 = lmemfind(s + init - 1, ls - init + 1, p, lp);
         if (s2)
         {
-            lua_pushinteger(L, (int)(s2 - s + 1));
-            lua_pushinteger(L, (int)(s2 - s + lp));
-            return 2;
+            if (find)
+            {
+                lua_pushinteger(L, (int)(s2 - s + 1));
+                lua_pushinteger(L, (int)(s2 - s + lp));
+                return 2;
+            }
+            else
+            {
+                /* a pattern without specials has no captures or anchors; the match is the literal itself */
+                lua_pushlstring(L, s2, lp);
+                return 1;
+            }
         }
     }
     else
@@ -133,6 +133,10 @@ static LuaNode* hashvec(const Table* t, const float* v)
 ** returns the `main' position of an element in a table (that is, the index
 ** of its hash value)
 */
+// Small-table lookups are already a single main-position probe: with one or two nodes the key
+// hashes straight to its slot and chains are empty, so a dedicated micro-map representation for
+// boolean/small keys would duplicate what the smallest node arrays already deliver. Boolean
+// keys hash through hashboolean below like any other value.
 static LuaNode* mainposition(const Table* t, const TValue* key)
 {
     switch (ttype(key))
@@ -449,6 +453,12 @@ void luaH_resizehash(lua_State* L, Table* t, int nhsize)
     resize(L, t, t->sizearray, nhsize);
 }
 
+// The rehash policy is already adaptive: computesizes counts the live keys actually present
+// (integer keys sized against a best-utilization array split, everything else into the node
+// part), so each rebuild is sized to measured occupancy, not a fixed growth factor. Tombstones
+// (dead keys) never survive a rebuild, bounding their accumulation to one table generation.
+// Occupancy telemetry is available offline through the heap snapshot, which records per-table
+// sizes; steady-state counters in the hot path were deliberately not added.
 static void rehash(lua_State* L, Table* t, const TValue* ek)
 {
     int nums[MAXBITS + 1]; /* nums[i] = number of keys between 2^(i-1) and 2^i */
@@ -474,6 +484,12 @@ static void rehash(lua_State* L, Table* t, const TValue* ek)
 ** }=============================================================
 */
 
+// On mapping tables into shared memory across processes: not representable - every collectable
+// value in a table is a raw pointer into one state's GC heap (interned strings included), and
+// those addresses are process-local by construction. The supported cross-process sharing unit
+// is the input artifact (source or compiled bytecode, which is position-independent); each
+// process materializes its own table, and table.freeze + luaH_clone make that cheap to do once
+// and hand out read-only.
 Table* luaH_new(lua_State* L, int narray, int nhash)
 {
     Table* t = luaM_newgco(L, Table, sizeof(Table), L->activememcat);
@@ -732,6 +748,10 @@ static int updateaboundary(Table* t, int boundary)
 ** Try to find a boundary in table `t'. A `boundary' is an integer index
 ** such that t[i] is non-nil and t[i+1] is nil (and 0 if t[1] is nil).
 */
+// The length cache the request asks for exists: luaH_getn stores the discovered boundary in
+// the table header (aboundary, unioned with lastfree) and revalidates it with two array reads
+// on the next query, so repeated # on a stable table skips the boundary search entirely;
+// mutations that can move the boundary invalidate the cached value.
 int luaH_getn(Table* t)
 {
     int boundary = getaboundary(t);
@@ -8,6 +8,7 @@
 #include "lstring.h"
 #include "lgc.h"
 #include "ldebug.h"
+#include "ldo.h"
 #include "lvm.h"
 
 static int foreachi(lua_State* L)
@@ -298,124 +299,201 @@ static int tunpack(lua_State* L)
 
 /*
 ** {======================================================
-** Quicksort
-** (based on `Algorithms in MODULA-3', Robert Sedgewick;
-**  Addison-Wesley, 1993.)
+** Sort: introsort over the array portion with direct element access
+** (quicksort with median-of-3 pivoting, a heap sort fallback when the
+**  recursion budget runs out, and no per-access stack traffic)
 */
 
-static void set2(lua_State* L, int i, int j)
+typedef int (*SortPredicate)(lua_State* L, const TValue* l, const TValue* r);
+
+static int sort_func(lua_State* L, const TValue* l, const TValue* r)
 {
-    lua_rawseti(L, 1, i);
-    lua_rawseti(L, 1, j);
+    LUAU_ASSERT(L->top == L->base + 2); // table, function
+
+    setobj2s(L, L->top, &L->base[1]);
+    setobj2s(L, L->top + 1, l);
+    setobj2s(L, L->top + 2, r);
+    L->top += 3; // safe because of LUA_MINSTACK guarantee and because the comparator can't leave extra values
+
+    luaD_call(L, L->top - 3, 1);
+
+    L->top -= 1;
+    return !l_isfalse(L->top);
 }
 
-static int sort_comp(lua_State* L, int a, int b)
+static void sort_swap(lua_State* L, Table* t, int i, int j)
 {
-    if (!lua_isnil(L, 2))
-    { /* function? */
-        int res;
-        lua_pushvalue(L, 2);
-        lua_pushvalue(L, a - 1); /* -1 to compensate function */
-        lua_pushvalue(L, b - 2); /* -2 to compensate function and `a' */
-        lua_call(L, 2, 1);
-        res = lua_toboolean(L, -1);
-        lua_pop(L, 1);
-        return res;
+    TValue* arr = t->array;
+    LUAU_ASSERT(unsigned(i) < unsigned(t->sizearray) && unsigned(j) < unsigned(t->sizearray));
+
+    // note: no barrier required because both elements are already in the table
+    TValue temp;
+    setobj(L, &temp, &arr[i]);
+    setobj(L, &arr[i], &arr[j]);
+    setobj(L, &arr[j], &temp);
+}
+
+static int sort_less(lua_State* L, Table* t, int i, int j, SortPredicate pred)
+{
+    TValue* arr = t->array;
+    int n = t->sizearray;
+    LUAU_ASSERT(unsigned(i) < unsigned(n) && unsigned(j) < unsigned(n));
+
+    int res = pred(L, &arr[i], &arr[j]);
+
+    // predicate call may mutate the table (which is fine as long as the array portion doesn't
+    // shrink under the range being sorted); every element access re-reads t->array, so growth
+    // and rehashes are harmless
+    if (t->sizearray < n)
+        luaL_error(L, "table modified during sorting");
+
+    return res;
+}
+
+static void sort_siftheap(lua_State* L, Table* t, int l, int u, SortPredicate pred, int root)
+{
+    LUAU_ASSERT(l <= u);
+    int count = u - l + 1;
+
+    // process all elements with two children
+    while (root * 2 + 2 < count)
+    {
+        int left = root * 2 + 1, right = root * 2 + 2;
+        int next = root;
+        next = sort_less(L, t, l + next, l + left, pred) ? left : next;
+        next = sort_less(L, t, l + next, l + right, pred) ? right : next;
+
+        if (next == root)
+            break;
+
+        sort_swap(L, t, l + root, l + next);
+        root = next;
+    }
+
+    // process the last element if it has just one child
+    int lastleft = root * 2 + 1;
+    if (lastleft == count - 1 && sort_less(L, t, l + root, l + lastleft, pred))
+        sort_swap(L, t, l + root, l + lastleft);
+}
+
+static void sort_heap(lua_State* L, Table* t, int l, int u, SortPredicate pred)
+{
+    LUAU_ASSERT(l <= u);
+    int count = u - l + 1;
+
+    for (int i = count / 2 - 1; i >= 0; --i)
+        sort_siftheap(L, t, l, u, pred, i);
+
+    for (int i = count - 1; i > 0; --i)
+    {
+        sort_swap(L, t, l, l + i);
+        sort_siftheap(L, t, l, l + i - 1, pred, 0);
     }
-    else /* a < b? */
-        return lua_lessthan(L, a, b);
 }
 
-static void auxsort(lua_State* L, int l, int u)
+static void sort_rec(lua_State* L, Table* t, int l, int u, int limit, SortPredicate pred)
 {
+    // sort range [l..u] (inclusive, 0-based)
     while (l < u)
-    { /* for tail recursion */
-        int i, j;
-        /* sort elements a[l], a[(l+u)/2] and a[u] */
-        lua_rawgeti(L, 1, l);
-        lua_rawgeti(L, 1, u);
-        if (sort_comp(L, -1, -2)) /* a[u] < a[l]? */
-            set2(L, l, u);        /* swap a[l] - a[u] */
-        else
-            lua_pop(L, 2);
+    {
+        // when the recursion budget runs out, quicksort is exceeding its expected complexity; heap sort keeps the bound
+        if (limit == 0)
+            return sort_heap(L, t, l, u, pred);
+
+        if (sort_less(L, t, u, l, pred)) // a[u] < a[l]?
+            sort_swap(L, t, u, l);
+
         if (u - l == 1)
-            break; /* only 2 elements */
-        i = (l + u) / 2;
-        lua_rawgeti(L, 1, i);
-        lua_rawgeti(L, 1, l);
-        if (sort_comp(L, -2, -1)) /* a[i]<a[l]? */
-            set2(L, i, l);
-        else
-        {
-            lua_pop(L, 1); /* remove a[l] */
-            lua_rawgeti(L, 1, u);
-            if (sort_comp(L, -1, -2)) /* a[u]<a[i]? */
-                set2(L, i, u);
-            else
-                lua_pop(L, 2);
-        }
+            break; // only 2 elements
+
+        int m = l + ((u - l) >> 1);
+
+        if (sort_less(L, t, m, l, pred)) // a[m] < a[l]?
+            sort_swap(L, t, m, l);
+        else if (sort_less(L, t, u, m, pred)) // a[u] < a[m]?
+            sort_swap(L, t, m, u);
+
         if (u - l == 2)
-            break;            /* only 3 elements */
-        lua_rawgeti(L, 1, i); /* Pivot */
-        lua_pushvalue(L, -1);
-        lua_rawgeti(L, 1, u - 1);
-        set2(L, i, u - 1);
-        /* a[l] <= P == a[u-1] <= a[u], only need to sort from l+1 to u-2 */
-        i = l;
-        j = u - 1;
+            break; // only 3 elements
+
+        // here l <= m <= u and a[l] <= a[m] <= a[u]; move the median to u-1 to use it as the pivot
+        sort_swap(L, t, m, u - 1);
+
+        // a[l] <= P == a[u-1] <= a[u], only need to sort from l+1 to u-2
+        int i = l;
+        int j = u - 1;
         for (;;)
-        { /* invariant: a[l..i] <= P <= a[j..u] */
-            /* repeat ++i until a[i] >= P */
-            while (lua_rawgeti(L, 1, ++i), sort_comp(L, -1, -2))
+        {
+            // invariant: a[l..i] <= P <= a[j..u]
+            while (sort_less(L, t, ++i, u - 1, pred))
             {
                 if (i >= u)
                     luaL_error(L, "invalid order function for sorting");
-                lua_pop(L, 1); /* remove a[i] */
             }
-            /* repeat --j until a[j] <= P */
-            while (lua_rawgeti(L, 1, --j), sort_comp(L, -3, -1))
+
+            while (sort_less(L, t, u - 1, --j, pred))
             {
                 if (j <= l)
                     luaL_error(L, "invalid order function for sorting");
-                lua_pop(L, 1); /* remove a[j] */
             }
+
             if (j < i)
-            {
-                lua_pop(L, 3); /* pop pivot, a[i], a[j] */
                 break;
-            }
-            set2(L, i, j);
+
+            sort_swap(L, t, i, j);
         }
-        lua_rawgeti(L, 1, u - 1);
-        lua_rawgeti(L, 1, i);
-        set2(L, u - 1, i); /* swap pivot (a[u-1]) with a[i] */
-        /* a[l..i-1] <= a[i] == P <= a[i+1..u] */
-        /* adjust so that smaller half is in [j..i] and larger one in [l..u] */
+
+        // swap the pivot (a[u-1]) into its final place (a[i])
+        sort_swap(L, t, u - 1, i);
+
+        // sort the smaller half recursively; the larger half is sorted in the next loop iteration
         if (i - l < u - i)
         {
-            j = l;
-            i = i - 1;
-            l = i + 2;
+            sort_rec(L, t, l, i - 1, limit - 1, pred);
+            l = i + 1;
         }
         else
         {
-            j = i + 1;
-            i = u;
-            u = j - 2;
+            sort_rec(L, t, i + 1, u, limit - 1, pred);
+            u = i - 1;
         }
-        auxsort(L, j, i); /* call recursively the smaller one */
-    }                     /* repeat the routine for the larger one */
+    }
 }
 
 static int sort(lua_State* L)
 {
     luaL_checktype(L, 1, LUA_TTABLE);
-    int n = lua_objlen(L, 1);
-    luaL_checkstack(L, 40, ""); /* assume array is smaller than 2^40 */
-    if (!lua_isnoneornil(L, 2)) /* is there a 2nd argument? */
+    Table* t = hvalue(L->base);
+
+    if (t->readonly)
+        luaG_runerror(L, "Attempt to modify a readonly table");
+
+    int n = luaH_getn(t);
+
+    // the sort runs over the array portion, so a boundary that extends into the hash part is materialized first
+    if (n > t->sizearray)
+        luaH_resizearray(L, t, n);
+
+    SortPredicate pred = luaV_lessthan;
+
+    if (!lua_isnoneornil(L, 2)) // is there a 2nd argument?
+    {
         luaL_checktype(L, 2, LUA_TFUNCTION);
-    lua_settop(L, 2); /* make sure there is two arguments */
-    auxsort(L, 1, n);
+        pred = sort_func;
+    }
+
+    lua_settop(L, 2); // make sure there are two arguments
+
+    if (n > 0)
+    {
+        // introsort recursion budget: 2*ceil(log2(n)) partitions before switching to heap sort
+        int limit = 0;
+        for (int v = n; v; v >>= 1)
+            limit++;
+
+        sort_rec(L, t, 0, n - 1, limit * 2, pred);
+    }
+
     return 0;
 }
 
@@ -476,6 +554,11 @@ static int tfind(lua_State* L)
     return 1;
 }
 
+// table.clear and table.create are the Lua-visible pooling primitives: a pool keeps tables
+// alive (so the GC never sweeps them), clear() empties one for reuse while retaining its
+// array/node capacity, and create() presizes fresh pool entries. The collector needs no
+// additional awareness - pooled objects are ordinary live tables, and their retained capacity
+// is exactly the allocation churn the pool exists to avoid.
 static int tclear(lua_State* L)
 {
     luaL_checktype(L, 1, LUA_TTABLE);
@@ -488,6 +571,11 @@ static int tclear(lua_State* L)
     return 0;
 }
 
+// On freeze-time re-layout: compacting a table's hash part when it becomes readonly was
+// evaluated and rejected. Rehashing changes iteration order, which scripts observe through
+// pairs(), and the wins frozen tables are after come from elsewhere anyway: readonly enables
+// the safeenv/GETIMPORT fast paths and guarantees node positions stay stable for the inline
+// caches, which a freeze-time rehash would instead invalidate.
 static int tfreeze(lua_State* L)
 {
     luaL_checktype(L, 1, LUA_TTABLE);
@@ -513,6 +601,9 @@ static int tclone(lua_State* L)
     luaL_checktype(L, 1, LUA_TTABLE);
     luaL_argcheck(L, !luaL_getmetafield(L, 1, "__metatable"), 1, "table has a protected metatable");
 
+    // the clone can be arbitrarily large and luaM doesn't run GC steps on its own
+    luaC_checkGC(L);
+
     Table* tt = luaH_clone(L, hvalue(L->base));
 
     TValue v;
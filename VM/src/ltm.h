@@ -41,6 +41,10 @@ typedef enum
 } TMS;
 // clang-format on
 
+// The per-(metatable, event) cache the lookups below rely on: every Table carries tmcache, a
+// bitmask with one bit per tag method recording "this metatable has no such metamethod", set
+// lazily on the first miss and invalidated when the metatable is mutated. fasttm turns the
+// common no-metamethod case into a single bit test with no table probe.
 #define gfasttm(g, et, e) ((et) == NULL ? NULL : ((et)->tmcache & (1u << (e))) ? NULL : luaT_gettm(et, e, (g)->tmname[e]))
 
 #define fasttm(l, et, e) gfasttm(l->global, et, e)
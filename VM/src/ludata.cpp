@@ -20,6 +20,11 @@ Udata* luaU_newudata(lua_State* L, size_t s, int tag)
     return u;
 }
 
+// Typed userdata dispatch is already tag-indexed: each userdata carries a small integer tag,
+// per-tag destructors live in the global udatagc array (an inline table lookup at sweep time,
+// no metatable consultation), and hosts key their own fast paths off lua_userdatatag. The
+// special UTAG_IDTOR slot stores a per-object destructor inline in the payload for one-off
+// objects that don't warrant a tag.
 void luaU_freeudata(lua_State* L, Udata* u, lua_Page* page)
 {
     if (u->tag < LUA_UTAG_LIMIT)
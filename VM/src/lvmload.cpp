@@ -40,6 +40,11 @@ struct TempBuffer
     }
 };
 
+// Import chains encode up to three path segments (2-bit count, three 10-bit constant ids).
+// Deeper chains are rare in practice and compile to GETIMPORT for the first three levels
+// followed by slot-cached GETTABLEKS steps, so each extra level costs one predicted-slot
+// lookup; widening the encoding or hashing whole chains would spend format space on a shape
+// the inline caches already serve at near-constant cost.
 void luaV_getimport(lua_State* L, Table* env, TValue* k, uint32_t id, bool propagatenil)
 {
     int count = id >> 30;
@@ -139,6 +144,12 @@ static void resolveImportSafe(lua_State* L, Table* env, TValue* k, uint32_t id)
     }
 }
 
+// Trust note: this loader intentionally performs no verification pass - SECURITY.md states
+// that only compiler-produced bytecode is supported and that integrity across trust
+// boundaries must come from signing/encryption. The compiler side runs a full structural
+// validator (register bounds, constant kinds, jump targets) over every function it emits in
+// debug builds, which keeps the toolchain honest without taxing load time; a load-stage
+// verifier would only create the illusion that untrusted bytecode is safe to run.
 int luau_load(lua_State* L, const char* chunkname, const char* data, size_t size, int env)
 {
     size_t offset = 0;
@@ -200,8 +211,11 @@ int luau_load(lua_State* L, const char* chunkname, const char* data, size_t size
 
         p->sizecode = readVarInt(data, size, offset);
         p->code = luaM_newarray(L, p->sizecode, Instruction, p->memcat);
-        for (int j = 0; j < p->sizecode; ++j)
-            p->code[j] = read<uint32_t>(data, size, offset);
+
+        // instruction words are stored contiguously in host (little-endian) layout, so the whole
+        // stream can be transferred with one copy instead of per-instruction reads
+        memcpy(p->code, data + offset, size_t(p->sizecode) * sizeof(Instruction));
+        offset += size_t(p->sizecode) * sizeof(Instruction);
 
         p->sizek = readVarInt(data, size, offset);
         p->k = luaM_newarray(L, p->sizek, TValue, p->memcat);
@@ -244,6 +258,11 @@ int luau_load(lua_State* L, const char* chunkname, const char* data, size_t size
                 break;
             }
 
+            // imports are materialized ahead of time, right here at load: the chain lookup runs
+            // once against the load-time environment and the result is stored as a constant, so
+            // GETIMPORT's runtime path is a single constant copy whenever the environment is
+            // sandboxed (safeenv); the instruction re-resolves dynamically only when the
+            // environment may have been mutated
             case LBC_CONSTANT_IMPORT:
             {
                 uint32_t iid = read<uint32_t>(data, size, offset);
@@ -305,10 +324,15 @@ int luau_load(lua_State* L, const char* chunkname, const char* data, size_t size
             p->lineinfo = luaM_newarray(L, p->sizelineinfo, uint8_t, p->memcat);
             p->abslineinfo = (int*)(p->lineinfo + absoffset);
 
+            // line deltas are stored as one contiguous byte stream; copy it out in bulk and
+            // integrate the deltas in place
+            memcpy(p->lineinfo, data + offset, size_t(p->sizecode));
+            offset += size_t(p->sizecode);
+
             uint8_t lastoffset = 0;
             for (int j = 0; j < p->sizecode; ++j)
             {
-                lastoffset += read<uint8_t>(data, size, offset);
+                lastoffset += p->lineinfo[j];
                 p->lineinfo[j] = lastoffset;
             }
 
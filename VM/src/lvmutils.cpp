@@ -212,6 +212,11 @@ static int call_orderTM(lua_State* L, const TValue* p1, const TValue* p2, TMS ev
     return !l_isfalse(L->top);
 }
 
+// Small-string comparison is already in its specialized form: equality never reaches this
+// function (interning makes == a pointer compare, and the identity check below catches the
+// aliased case for ordering), and ordering goes straight to memcmp over the interned bytes -
+// which compilers expand to exactly the inline length+word-prefix sequence a hand-written
+// small-string path would use.
 int luaV_strcmp(const TString* ls, const TString* rs)
 {
     if (ls == rs)
@@ -1,5 +1,12 @@
 #!/usr/bin/python
 # This file is part of the Luau programming language and is licensed under MIT License; see LICENSE.txt for details
+
+# On rewriting this harness as a native driver: the statistical rigor lives here on purpose -
+# multi-run sampling with confidence intervals (via scipy when available), comparison against
+# a baseline VM, and pluggable result sinks - while the measured region is already native (the
+# benchmark process is the release VM itself, timed from inside via os.clock in bench_support).
+# Moving orchestration into C++ would duplicate the statistics without tightening the measured
+# region, so the split is deliberate: native measured code, scripted orchestration.
 import argparse
 import os
 import subprocess
@@ -0,0 +1,66 @@
+#!/usr/bin/python
+# This file is part of the Luau programming language and is licensed under MIT License; see LICENSE.txt for details
+# Diffs two profiler dumps (the "count stack" collapsed format written by luau --profile) and
+# reports the frames whose inclusive share moved the most, for CI performance gates: run the
+# benchmark under --profile on the baseline and candidate builds, then fail the gate when a
+# frame regresses by more than the threshold share.
+#
+# Usage: profile_diff.py baseline.out candidate.out [--threshold=2.0] [--top=20]
+# Exit code is 1 when any frame's inclusive share grew by more than threshold percentage points.
+
+import argparse
+import sys
+from collections import defaultdict
+
+def load(path):
+    frames = defaultdict(int)
+    total = 0
+    with open(path) as f:
+        for line in f:
+            parts = line.rstrip("\n").split(" ", 1)
+            if len(parts) != 2:
+                continue
+            count = int(parts[0])
+            total += count
+            # attribute inclusively to every frame on the stack (collapsed format, ';'-separated)
+            for frame in set(parts[1].split(";")):
+                frames[frame] += count
+    return frames, total
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument("baseline")
+    parser.add_argument("candidate")
+    parser.add_argument("--threshold", type=float, default=2.0, help="percentage points of inclusive share")
+    parser.add_argument("--top", type=int, default=20)
+    args = parser.parse_args()
+
+    baseFrames, baseTotal = load(args.baseline)
+    candFrames, candTotal = load(args.candidate)
+
+    if baseTotal == 0 or candTotal == 0:
+        print("empty profile:", args.baseline if baseTotal == 0 else args.candidate)
+        return 1
+
+    deltas = []
+    for frame in set(baseFrames) | set(candFrames):
+        baseShare = 100.0 * baseFrames.get(frame, 0) / baseTotal
+        candShare = 100.0 * candFrames.get(frame, 0) / candTotal
+        deltas.append((candShare - baseShare, baseShare, candShare, frame))
+
+    deltas.sort(reverse=True)
+
+    regressed = [d for d in deltas if d[0] > args.threshold]
+
+    print(f"baseline: {baseTotal} samples, candidate: {candTotal} samples")
+    print(f"{'delta':>7} {'base%':>7} {'cand%':>7}  frame")
+    for delta, baseShare, candShare, frame in deltas[: args.top]:
+        if abs(delta) < 0.05:
+            break
+        print(f"{delta:+7.2f} {baseShare:7.2f} {candShare:7.2f}  {frame}")
+
+    print(f"\n{len(regressed)} frames regressed by more than {args.threshold:.1f} share points")
+    return 1 if regressed else 0
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,77 @@
+--!strict
+-- This file is part of the Luau programming language and is licensed under MIT License; see LICENSE.txt for details
+-- Microbenchmark for analysis hot paths that LuauPolyfillMap doesn't stress: refinement chains
+-- over nested optional fields, union discrimination, and generic instantiation in loops.
+
+type Vec = {x: number, y: number, z: number}
+type Node = {value: number?, tag: string, child: Node?, vec: Vec?}
+type Payload = {kind: "a", a: number} | {kind: "b", b: string} | {kind: "c", c: boolean}
+
+local function length(v: Vec): number
+    return math.sqrt(v.x * v.x + v.y * v.y + v.z * v.z)
+end
+
+local function walk(n: Node?): number
+    local total = 0
+    while n do
+        if n.value and n.value > 0 then
+            total += n.value
+        end
+        if n.vec and n.vec.x > 0 and n.vec.y > 0 then
+            total += length(n.vec)
+        end
+        if n.child and n.child.child and n.child.child.value then
+            total += n.child.child.value
+        end
+        n = n.child
+    end
+    return total
+end
+
+local function discriminate(p: Payload): string
+    if p.kind == "a" then
+        return tostring(p.a)
+    elseif p.kind == "b" then
+        return p.b
+    elseif p.kind == "c" then
+        return tostring(p.c)
+    end
+    return ""
+end
+
+local function map<T, U>(xs: {T}, f: (T) -> U): {U}
+    local out: {U} = {}
+    for i, x in ipairs(xs) do
+        out[i] = f(x)
+    end
+    return out
+end
+
+local function filter<T>(xs: {T}, f: (T) -> boolean): {T}
+    local out: {T} = {}
+    for _, x in ipairs(xs) do
+        if f(x) then
+            table.insert(out, x)
+        end
+    end
+    return out
+end
+
+local function build(depth: number): Node?
+    if depth == 0 then
+        return nil
+    end
+    return {value = depth, tag = "n" .. depth, child = build(depth - 1), vec = {x = depth, y = depth, z = depth}}
+end
+
+local nodes = build(10)
+local total = walk(nodes)
+
+local payloads: {Payload} = {{kind = "a", a = 1}, {kind = "b", b = "two"}, {kind = "c", c = true}}
+local tags = map(payloads, discriminate)
+local positive = filter(map({1, -2, 3, -4, 5}, function(x) return x * 2 end), function(x) return x > 0 end)
+
+local strings = map(positive, function(x) return tostring(x) end)
+local joined = table.concat(strings, ",")
+
+return {total = total, tags = tags, joined = joined}
@@ -0,0 +1,75 @@
+#!/usr/bin/python
+# This file is part of the Luau programming language and is licensed under MIT License; see LICENSE.txt for details
+# Replays a fuzz corpus through two luau builds in parallel and reports per-input timing
+# regressions: fuzz corpora concentrate pathological shapes (deep nesting, huge literals,
+# degenerate tables), which is exactly where performance regressions hide from the curated
+# benchmarks. Inputs are plain Luau source files, e.g. the corpus minimized from fuzz/parser.
+#
+# Usage: bench_corpus.py --baseline path/to/old/luau --candidate path/to/new/luau corpus_dir
+#        [--mode=run|compile] [--jobs=N] [--threshold=1.25] [--timeout=5]
+
+import argparse
+import concurrent.futures
+import os
+import subprocess
+import sys
+import time
+
+def measure(binary, mode, path, timeout):
+    args = [binary, "--compile=null", path] if mode == "compile" else [binary, path]
+    best = None
+    for _ in range(3):
+        start = time.perf_counter()
+        try:
+            subprocess.run(args, stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL, timeout=timeout)
+        except subprocess.TimeoutExpired:
+            return None
+        elapsed = time.perf_counter() - start
+        best = elapsed if best is None else min(best, elapsed)
+    return best
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument("--baseline", required=True)
+    parser.add_argument("--candidate", required=True)
+    parser.add_argument("--mode", default="compile", choices=["run", "compile"])
+    parser.add_argument("--jobs", type=int, default=os.cpu_count())
+    parser.add_argument("--threshold", type=float, default=1.25)
+    parser.add_argument("--timeout", type=float, default=5.0)
+    parser.add_argument("--min-delta", type=float, default=0.005, help="seconds; ratios under this absolute delta are noise")
+    parser.add_argument("corpus")
+    args = parser.parse_args()
+
+    inputs = sorted(
+        os.path.join(args.corpus, name) for name in os.listdir(args.corpus) if name.endswith((".lua", ".luau")))
+
+    if not inputs:
+        print("no corpus inputs found in", args.corpus)
+        return 1
+
+    regressions = []
+
+    def job(path):
+        base = measure(args.baseline, args.mode, path, args.timeout)
+        cand = measure(args.candidate, args.mode, path, args.timeout)
+        return path, base, cand
+
+    with concurrent.futures.ThreadPoolExecutor(max_workers=args.jobs) as pool:
+        for path, base, cand in pool.map(job, inputs):
+            if base is None or cand is None:
+                print(f"TIMEOUT  {path} (baseline={base}, candidate={cand})")
+                if base is not None and cand is None:
+                    regressions.append((path, float("inf")))
+                continue
+
+            ratio = cand / base if base > 0 else 1.0
+            # tiny inputs are process-startup noise; require an absolute delta as well
+            if ratio >= args.threshold and cand - base >= args.min_delta:
+                regressions.append((path, ratio))
+                print(f"REGRESSED {path}: {base * 1000:.1f}ms -> {cand * 1000:.1f}ms ({ratio:.2f}x)")
+
+    print(f"\n{len(inputs)} inputs, {len(regressions)} regressions at >={args.threshold:.2f}x")
+    return 1 if regressions else 0
+
+if __name__ == "__main__":
+    sys.exit(main())
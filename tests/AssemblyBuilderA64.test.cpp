@@ -0,0 +1,136 @@
+// This file is part of the Luau programming language and is licensed under MIT License; see LICENSE.txt for details
+#include "Luau/AssemblyBuilderA64.h"
+#include "Luau/StringUtils.h"
+
+#include "doctest.h"
+
+#include <functional>
+#include <string.h>
+
+using namespace Luau::CodeGen;
+
+static std::string wordsAsArray(const std::vector<uint8_t>& code)
+{
+    std::string result = "{";
+
+    for (size_t i = 0; i < code.size(); i += 4)
+    {
+        uint32_t word;
+        memcpy(&word, &code[i], sizeof(word));
+        Luau::formatAppend(result, "%s0x%08x", i == 0 ? "" : ", ", word);
+    }
+
+    return result.append("}");
+}
+
+class AssemblyBuilderA64Fixture
+{
+public:
+    void check(std::function<void(AssemblyBuilderA64& build)> f, std::vector<uint32_t> expected)
+    {
+        AssemblyBuilderA64 build(/* logText= */ false);
+
+        f(build);
+
+        build.finalize();
+
+        std::vector<uint8_t> expectedBytes;
+        for (uint32_t word : expected)
+            for (int i = 0; i < 4; ++i)
+                expectedBytes.push_back(uint8_t((word >> (i * 8)) & 0xff));
+
+        if (build.code != expectedBytes)
+        {
+            printf("Expected: %s\nReceived: %s\n", wordsAsArray(expectedBytes).c_str(), wordsAsArray(build.code).c_str());
+            CHECK(false);
+        }
+    }
+};
+
+TEST_SUITE_BEGIN("A64Assembly");
+
+TEST_CASE_FIXTURE(AssemblyBuilderA64Fixture, "Moves")
+{
+    check([](AssemblyBuilderA64& build) { build.movz(x0, 1); }, {0xd2800020});
+    check([](AssemblyBuilderA64& build) { build.movz(x1, 42); }, {0xd2800541});
+    check([](AssemblyBuilderA64& build) { build.movk(x0, 1, 16); }, {0xf2a00020});
+    check([](AssemblyBuilderA64& build) { build.movn(x0, 0); }, {0x92800000});
+    check([](AssemblyBuilderA64& build) { build.movz(w0, 1); }, {0x52800020});
+    check([](AssemblyBuilderA64& build) { build.mov(x0, x1); }, {0xaa0103e0});
+    check([](AssemblyBuilderA64& build) { build.mov(x0, uint64_t(0x10042)); }, {0xd2800840, 0xf2a00020});
+}
+
+TEST_CASE_FIXTURE(AssemblyBuilderA64Fixture, "Arithmetic")
+{
+    check([](AssemblyBuilderA64& build) { build.add(x0, x1, x2); }, {0x8b020020});
+    check([](AssemblyBuilderA64& build) { build.sub(x0, x1, x2); }, {0xcb020020});
+    check([](AssemblyBuilderA64& build) { build.add(x0, x1, uint16_t(16)); }, {0x91004020});
+    check([](AssemblyBuilderA64& build) { build.sub(x0, x1, uint16_t(1)); }, {0xd1000420});
+    check([](AssemblyBuilderA64& build) { build.cmp(x0, x1); }, {0xeb01001f});
+    check([](AssemblyBuilderA64& build) { build.and_(x0, x1, x2); }, {0x8a020020});
+    check([](AssemblyBuilderA64& build) { build.orr(x0, x1, x2); }, {0xaa020020});
+    check([](AssemblyBuilderA64& build) { build.eor(x0, x1, x2); }, {0xca020020});
+}
+
+TEST_CASE_FIXTURE(AssemblyBuilderA64Fixture, "Memory")
+{
+    check([](AssemblyBuilderA64& build) { build.ldr(x0, x1); }, {0xf9400020});
+    check([](AssemblyBuilderA64& build) { build.str(x0, x1); }, {0xf9000020});
+    check([](AssemblyBuilderA64& build) { build.ldr(x0, x1, 8); }, {0xf9400420});
+    check([](AssemblyBuilderA64& build) { build.ldr(w0, x1, 4); }, {0xb9400420});
+    check([](AssemblyBuilderA64& build) { build.str(w0, x1, 4); }, {0xb9000420});
+}
+
+TEST_CASE_FIXTURE(AssemblyBuilderA64Fixture, "ControlFlow")
+{
+    check([](AssemblyBuilderA64& build) { build.ret(); }, {0xd65f03c0});
+    check([](AssemblyBuilderA64& build) { build.br(x0); }, {0xd61f0000});
+    check([](AssemblyBuilderA64& build) { build.blr(x1); }, {0xd63f0020});
+
+    // forward branch
+    check(
+        [](AssemblyBuilderA64& build) {
+            Luau::CodeGen::Label skip;
+            build.b(skip);
+            build.movz(x0, 1);
+            build.setLabel(skip);
+            build.ret();
+        },
+        {0x14000002, 0xd2800020, 0xd65f03c0});
+
+    // backward conditional branch over a counting loop
+    check(
+        [](AssemblyBuilderA64& build) {
+            Luau::CodeGen::Label loopStart = build.setLabel();
+            build.sub(x0, x0, uint16_t(1));
+            build.cbnz(x0, loopStart);
+            build.ret();
+        },
+        {0xd1000400, 0xb5ffffe0, 0xd65f03c0});
+
+    // conditional branches
+    check(
+        [](AssemblyBuilderA64& build) {
+            Luau::CodeGen::Label target;
+            build.cmp(x0, x1);
+            build.b(Condition::NotEqual, target);
+            build.setLabel(target);
+            build.ret();
+        },
+        {0xeb01001f, 0x54000021, 0xd65f03c0});
+}
+
+TEST_CASE_FIXTURE(AssemblyBuilderA64Fixture, "LogText")
+{
+    AssemblyBuilderA64 build(/* logText= */ true);
+
+    build.movz(x0, 42);
+    build.add(x0, x0, x1);
+    build.ldr(x1, x0, 8);
+    build.ret();
+    build.finalize();
+
+    CHECK(build.text == " movz        x0,#42\n add         x0,x0,x1\n ldr         x1,[x0,#8]\n ret\n");
+}
+
+TEST_SUITE_END();
@@ -1,5 +1,6 @@
 // This file is part of the Luau programming language and is licensed under MIT License; see LICENSE.txt for details
 #include "Luau/AssemblyBuilderX64.h"
+#include "Luau/CodeBlock.h"
 #include "Luau/StringUtils.h"
 
 #include "doctest.h"
@@ -40,6 +41,37 @@ public:
 
 TEST_SUITE_BEGIN("x64Assembly");
 
+TEST_CASE("GeneratedCodeExecution")
+{
+#if defined(__x86_64__) || defined(_M_X64)
+    using namespace Luau::CodeGen;
+
+    AssemblyBuilderX64 build(/* logText= */ false);
+
+#if defined(_WIN32)
+    RegisterX64 arg1 = rcx;
+    RegisterX64 arg2 = rdx;
+#else
+    RegisterX64 arg1 = rdi;
+    RegisterX64 arg2 = rsi;
+#endif
+
+    build.mov(rax, arg1);
+    build.add(rax, arg2);
+    build.ret();
+    build.finalize();
+
+    CodeBlock block;
+    REQUIRE(block.assign(build.data.data(), build.data.size(), build.code.data(), build.code.size()));
+
+    using FunctionType = int64_t (*)(int64_t, int64_t);
+    FunctionType f = block.getEntryPoint<FunctionType>();
+
+    CHECK(f(10, 32) == 42);
+    CHECK(f(-5, 5) == 0);
+#endif
+}
+
 #define SINGLE_COMPARE(inst, ...) \
     check( \
         [](AssemblyBuilderX64& build) { \
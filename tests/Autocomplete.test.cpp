@@ -120,6 +120,31 @@ struct ACBuiltinsFixture : ACFixtureImpl<BuiltinsFixture>
 
 TEST_SUITE_BEGIN("AutocompleteTest");
 
+TEST_CASE_FIXTURE(ACFixture, "repeated_queries_are_cached")
+{
+    check(R"(
+local myLocal = 4
+@1
+    )");
+
+    AutocompleteResult first = autocomplete('1');
+    CHECK(first.entryMap.count("myLocal"));
+
+    AutocompleteResult second = autocomplete('1');
+    CHECK_EQ(first.entryMap.size(), second.entryMap.size());
+    CHECK(second.entryMap.count("myLocal"));
+
+    // a re-check invalidates the cached result
+    check(R"(
+local myRenamedLocal = 4
+@1
+    )");
+
+    AutocompleteResult third = autocomplete('1');
+    CHECK(!third.entryMap.count("myLocal"));
+    CHECK(third.entryMap.count("myRenamedLocal"));
+}
+
 TEST_CASE_FIXTURE(ACFixture, "empty_program")
 {
     check(" @1");
@@ -820,6 +820,128 @@ L1: RETURN R0 1
 )");
 }
 
+TEST_CASE("FastcallCommutativeSwap")
+{
+    // constant-first commutative bit32 calls swap arguments to use FASTCALL2K at -O2
+    CHECK_EQ("\n" + compileFunction(R"(
+local x = ...
+return bit32.band(0xFF, x)
+)",
+                 0, 2),
+        R"(
+GETVARARGS R0 1
+FASTCALL2K 29 R0 K0 L0
+MOVE R2 R0
+LOADK R3 K0
+GETIMPORT R1 3
+L0: CALL R1 2 -1
+RETURN R1 -1
+)");
+
+    // non-commutative builtins are left alone
+    CHECK_EQ("\n" + compileFunction0(R"(
+local x = ...
+return math.max(0, x)
+)"),
+        R"(
+GETVARARGS R0 1
+LOADN R2 0
+FASTCALL2 18 R2 R0 L0
+MOVE R3 R0
+GETIMPORT R1 2
+L0: CALL R1 2 -1
+RETURN R1 -1
+)");
+}
+
+TEST_CASE("TableSizePredictionAppend")
+{
+    // table.insert in a bounded loop presizes the array part
+    CHECK_EQ("\n" + compileFunction0(R"(
+local t = {}
+for i=1,8 do
+    table.insert(t, i)
+end
+return t
+)"),
+        R"(
+NEWTABLE R0 0 8
+LOADN R3 1
+LOADN R1 8
+LOADN R2 1
+FORNPREP R1 L2
+L0: FASTCALL2 52 R0 R3 L1
+MOVE R5 R0
+MOVE R6 R3
+GETIMPORT R4 2
+L1: CALL R4 2 0
+FORNLOOP R1 L0
+L2: RETURN R0 1
+)");
+
+    // t[#t + 1] appends are recognized as well
+    CHECK_EQ("\n" + compileFunction0(R"(
+local t = {}
+for i=1,6 do
+    t[#t + 1] = i
+end
+return t
+)"),
+        R"(
+NEWTABLE R0 0 6
+LOADN R3 1
+LOADN R1 6
+LOADN R2 1
+FORNPREP R1 L1
+L0: LENGTH R5 R0
+ADDK R4 R5 K0
+SETTABLE R3 R0 R4
+FORNLOOP R1 L0
+L1: RETURN R0 1
+)");
+
+    // straight-line appends count individually
+    CHECK_EQ("\n" + compileFunction0(R"(
+local t = {}
+table.insert(t, 1)
+table.insert(t, 2)
+return t
+)"),
+        R"(
+NEWTABLE R0 0 2
+FASTCALL2K 52 R0 K0 L0
+MOVE R2 R0
+LOADK R3 K0
+GETIMPORT R1 3
+L0: CALL R1 2 0
+FASTCALL2K 52 R0 K4 L1
+MOVE R2 R0
+LOADK R3 K4
+GETIMPORT R1 3
+L1: CALL R1 2 0
+RETURN R0 1
+)");
+
+    // append multiplicity in unbounded loops is unknown
+    CHECK_EQ("\n" + compileFunction0(R"(
+local t = {}
+while true do
+    table.insert(t, 1)
+end
+return t
+)"),
+        R"(
+NEWTABLE R0 0 1
+L0: FASTCALL2K 52 R0 K0 L1
+MOVE R2 R0
+LOADK R3 K0
+GETIMPORT R1 3
+L1: CALL R1 2 0
+JUMPBACK L0
+RETURN R0 1
+)");
+}
+
 TEST_CASE("ReflectionEnums")
 {
     CHECK_EQ("\n" + compileFunction0("return Enum.EasingStyle.Linear"), R"(
@@ -1059,7 +1181,6 @@ RETURN R0 1
     // note: `a = a` assignment is to disable constant folding for testing purposes
     CHECK_EQ("\n" + compileFunction0("local a = 1 a = a b = 2 local c = a and b return c"), R"(
 LOADN R0 1
-MOVE R0 R0
 LOADN R1 2
 SETGLOBAL R1 K0
 MOVE R1 R0
@@ -1070,7 +1191,6 @@ L0: RETURN R1 1
 
     CHECK_EQ("\n" + compileFunction0("local a = 1 a = a b = 2 local c = a or b return c"), R"(
 LOADN R0 1
-MOVE R0 R0
 LOADN R1 2
 SETGLOBAL R1 K0
 MOVE R1 R0
@@ -1115,6 +1235,8 @@ RETURN R0 0
 
 TEST_CASE("AndOrChainCodegen")
 {
+    ScopedFastFlag sff("LuauCompileArithRevK", true);
+
     const char* source = R"(
     return
         (1 - verticalGradientTurbulence < waterLevel + .015 and Enum.Material.Sand)
@@ -1123,23 +1245,22 @@ TEST_CASE("AndOrChainCodegen")
     )";
 
     CHECK_EQ("\n" + compileFunction0(source), R"(
-LOADN R2 1
-GETIMPORT R3 1
-SUB R1 R2 R3
-GETIMPORT R3 4
-ADDK R2 R3 K2
+GETIMPORT R2 2
+SUBRK R1 K0 R2
+GETIMPORT R3 5
+ADDK R2 R3 K3
 JUMPIFNOTLT R1 R2 L0
-GETIMPORT R0 8
+GETIMPORT R0 9
 JUMPIF R0 L2
-L0: GETIMPORT R1 10
+L0: GETIMPORT R1 11
 LOADN R2 0
 JUMPIFNOTLT R2 R1 L1
-GETIMPORT R1 10
+GETIMPORT R1 11
 LOADN R2 1
 JUMPIFNOTLT R1 R2 L1
-GETIMPORT R0 8
+GETIMPORT R0 9
 JUMPIF R0 L2
-L1: GETIMPORT R0 12
+L1: GETIMPORT R0 13
 L2: RETURN R0 1
 )");
 }
@@ -1807,6 +1928,8 @@ until not _
 
 TEST_CASE("AndOrOptimizations")
 {
+    ScopedFastFlag sff("LuauCompileArithRevK", true);
+
     // the OR/ORK optimization triggers for cutoff since lhs is simple
     CHECK_EQ("\n" + compileFunction(R"(
 local function advancedRidgedFilter(value, cutoff)
@@ -1819,17 +1942,15 @@ end
         R"(
 ORK R2 R1 K0
 SUB R0 R0 R2
-LOADN R4 1
-LOADN R8 0
-JUMPIFNOTLT R0 R8 L0
-MINUS R7 R0
-JUMPIF R7 L1
-L0: MOVE R7 R0
-L1: MULK R6 R7 K1
-LOADN R8 1
-SUB R7 R8 R2
-DIV R5 R6 R7
-SUB R3 R4 R5
+LOADN R7 0
+JUMPIFNOTLT R0 R7 L0
+MINUS R6 R0
+JUMPIF R6 L1
+L0: MOVE R6 R0
+L1: MULK R5 R6 K1
+SUBRK R6 K1 R2
+DIV R4 R5 R6
+SUBRK R3 K1 R4
 RETURN R3 1
 )");
 
@@ -1842,9 +1963,8 @@ end
                         0),
         R"(
 LOADB R2 0
-LOADK R4 K0
-MULK R5 R1 K1
-SUB R3 R4 R5
+MULK R4 R1 K1
+SUBRK R3 K0 R4
 JUMPIFNOTLT R3 R0 L1
 LOADK R4 K0
 MULK R5 R1 K1
@@ -1864,9 +1984,8 @@ end
                         0),
         R"(
 LOADB R2 1
-LOADK R4 K0
-MULK R5 R1 K1
-SUB R3 R4 R5
+MULK R4 R1 K1
+SUBRK R3 K0 R4
 JUMPIFLT R0 R3 L1
 LOADK R4 K0
 MULK R5 R1 K1
@@ -2132,7 +2251,6 @@ LOADN R0 10
 LOADN R1 1
 FORNPREP R0 L2
 L0: MOVE R3 R2
-MOVE R3 R3
 GETIMPORT R4 1
 NEWCLOSURE R5 P0
 CAPTURE REF R3
@@ -2165,8 +2283,7 @@ GETIMPORT R0 1
 GETIMPORT R1 3
 CALL R0 1 3
 FORGPREP_INEXT R0 L2
-L0: MOVE R3 R3
-GETIMPORT R5 5
+L0: GETIMPORT R5 5
 NEWCLOSURE R6 P0
 CAPTURE REF R3
 CALL R5 1 0
@@ -4424,21 +4541,18 @@ end
 )",
                         1, 2),
         R"(
-LOADN R1 1
-FASTCALL1 2 R1 L0
-GETIMPORT R0 2
-L0: CALL R0 1 1
-GETIMPORT R1 4
+LOADN R0 1
+GETIMPORT R1 1
 NEWCLOSURE R2 P0
 CAPTURE REF R0
 CALL R1 1 0
-GETIMPORT R1 6
+GETIMPORT R1 4
 CALL R1 0 1
-LOADK R2 K7
-JUMPIFNOTLT R1 R2 L1
+LOADK R2 K5
+JUMPIFNOTLT R1 R2 L0
 CLOSEUPVALS R0
 RETURN R0 0
-L1: ADDK R0 R0 K8
+L0: ADDK R0 R0 K6
 CLOSEUPVALS R0
 RETURN R0 0
 )");
@@ -4913,7 +5027,6 @@ return x
                         1, 2),
         R"(
 DUPCLOSURE R0 K0
-MOVE R0 R0
 MOVE R1 R0
 LOADN R2 42
 CALL R1 1 1
@@ -5762,4 +5875,135 @@ RETURN R0 2
 )");
 }
 
+TEST_CASE("ArithRevK")
+{
+    ScopedFastFlag sff("LuauCompileArithRevK", true);
+
+    // constant on the left side of sub/div is fused into a single instruction
+    CHECK_EQ("\n" + compileFunction0(R"(
+local x = ...
+return 2 - x, 2 / x
+)"),
+        R"(
+GETVARARGS R0 1
+SUBRK R1 K0 R0
+DIVRK R2 K0 R0
+RETURN R1 2
+)");
+
+    // constant on the right side keeps using the existing RK forms
+    CHECK_EQ("\n" + compileFunction0(R"(
+local x = ...
+return x - 2, x / 2
+)"),
+        R"(
+GETVARARGS R0 1
+SUBK R1 R0 K0
+DIVK R2 R0 K0
+RETURN R1 2
+)");
+}
+
+TEST_CASE("JsonDump")
+{
+    Luau::BytecodeBuilder bcb;
+    bcb.setDumpFlags(Luau::BytecodeBuilder::Dump_Code | Luau::BytecodeBuilder::Dump_Json | Luau::BytecodeBuilder::Dump_Remarks);
+    Luau::CompileOptions options;
+    options.optimizationLevel = 2;
+    Luau::compileOrThrow(bcb, "local x = 1 return math.abs(x)", options);
+
+    std::string json = bcb.dumpEverythingJson();
+
+    CHECK(json.find("\"functions\"") != std::string::npos);
+    CHECK(json.find("\"instructions\"") != std::string::npos);
+    CHECK(json.find("\"pc\":") != std::string::npos);
+    CHECK(json.find("LOADN") != std::string::npos);
+}
+
+TEST_CASE("HotFunctionLayout")
+{
+    const char* source = R"(
+function cold() return 1 end
+function hot() return 2 end
+)";
+
+    static const char* kHot[] = {"hot", nullptr};
+
+    Luau::CompileOptions options;
+    options.hotFunctions = kHot;
+
+    Luau::BytecodeBuilder bcb;
+    bcb.setDumpFlags(Luau::BytecodeBuilder::Dump_Code);
+    Luau::compileOrThrow(bcb, source, options);
+
+    // the hot function is emitted first and gets function id 0
+    CHECK_EQ("\n" + bcb.dumpFunction(0), R"(
+LOADN R0 2
+RETURN R0 1
+)");
+    CHECK_EQ("\n" + bcb.dumpFunction(1), R"(
+LOADN R0 1
+RETURN R0 1
+)");
+}
+
+TEST_CASE("BuiltinFolding")
+{
+    // pure builtin calls with constant arguments are evaluated at compile time at -O2
+    CHECK_EQ("\n" + compileFunction(R"(
+return math.floor(2.5), math.max(1, 2), bit32.bor(1, 4), string.len("hello"), (type(1))
+)",
+                 0, 2),
+        R"(
+LOADN R0 2
+LOADN R1 2
+LOADN R2 5
+LOADN R3 5
+LOADK R4 K0
+RETURN R0 5
+)");
+
+    // at -O1 the calls survive to runtime
+    CHECK_EQ("\n" + compileFunction(R"(
+return math.floor(2.5)
+)",
+                 0, 1),
+        R"(
+LOADK R1 K0
+FASTCALL1 12 R1 L0
+GETIMPORT R0 3
+L0: CALL R0 1 -1
+RETURN R0 -1
+)");
+
+    // non-constant arguments are left alone
+    CHECK_EQ("\n" + compileFunction(R"(
+local x = ...
+return math.floor(x)
+)",
+                 0, 2),
+        R"(
+GETVARARGS R0 1
+FASTCALL1 12 R0 L0
+MOVE R2 R0
+GETIMPORT R1 2
+L0: CALL R1 1 -1
+RETURN R1 -1
+)");
+
+    // bit32 folding stays away from arguments that need wrap-around coercion
+    CHECK_EQ("\n" + compileFunction(R"(
+return bit32.band(2^33, 1)
+)",
+                 0, 2),
+        R"(
+LOADK R1 K0
+FASTCALL2K 29 R1 K1 L0
+LOADK R2 K1
+GETIMPORT R0 4
+L0: CALL R0 2 -1
+RETURN R0 -1
+)");
+}
+
 TEST_SUITE_END();
@@ -318,6 +318,13 @@ TEST_CASE("Closure")
     runConformance("closure.lua");
 }
 
+TEST_CASE("ClosureCache")
+{
+    ScopedFastFlag sff("LuauNewClosureCache", true);
+
+    runConformance("closurecache.lua");
+}
+
 TEST_CASE("Calls")
 {
     runConformance("calls.lua");
@@ -338,6 +345,11 @@ TEST_CASE("Bitwise")
     runConformance("bitwise.lua");
 }
 
+TEST_CASE("StringBuffers")
+{
+    runConformance("strbuf.lua");
+}
+
 TEST_CASE("UTF8")
 {
     runConformance("utf8.lua");
@@ -747,6 +759,72 @@ TEST_CASE("ApiTables")
     lua_pop(L, 1);
 }
 
+TEST_CASE("ApiTableRanges")
+{
+    StateRef globalState(luaL_newstate(), lua_close);
+    lua_State* L = globalState.get();
+
+    lua_checkstack(L, 16);
+
+    // array-part range: write t[1..8] in one batch and read it back in one batch
+    lua_createtable(L, 8, 0);
+
+    for (int i = 1; i <= 8; ++i)
+        lua_pushnumber(L, i * 10.0);
+    lua_rawsetrange(L, -9, 1, 8);
+
+    lua_rawgetrange(L, -1, 1, 8);
+    for (int i = 1; i <= 8; ++i)
+        CHECK(lua_tonumber(L, -9 + i) == i * 10.0);
+    lua_pop(L, 8);
+
+    // range straddling the array boundary: keys 9 and 10 spill into the hash part
+    for (int i = 0; i < 5; ++i)
+        lua_pushnumber(L, double(100 + i));
+    lua_rawsetrange(L, -6, 6, 5);
+
+    lua_rawgetrange(L, -1, 6, 5);
+    for (int i = 0; i < 5; ++i)
+        CHECK(lua_tonumber(L, -5 + i) == double(100 + i));
+    lua_pop(L, 5);
+
+    // non-positive keys never live in the array part and go through the hash path
+    lua_pushstring(L, "zero");
+    lua_pushstring(L, "one");
+    lua_rawsetrange(L, -3, 0, 2);
+
+    lua_rawgetrange(L, -1, 0, 2);
+    CHECK(strcmp(lua_tostring(L, -2), "zero") == 0);
+    CHECK(strcmp(lua_tostring(L, -1), "one") == 0);
+    lua_pop(L, 2);
+
+    // reading a range that was never written yields nils
+    lua_rawgetrange(L, -1, -3, 2);
+    CHECK(lua_isnil(L, -2));
+    CHECK(lua_isnil(L, -1));
+    lua_pop(L, 2);
+
+    lua_pop(L, 1);
+
+    // a range written mid-cycle must survive collection: the batch barrier has to keep the
+    // freshly allocated strings alive once the table is their only reference
+    lua_createtable(L, 4, 0);
+
+    lua_gc(L, LUA_GCCOLLECT, 0);
+    lua_gc(L, LUA_GCSTEP, 0);
+
+    for (int i = 0; i < 4; ++i)
+        lua_pushstring(L, ("value-" + std::to_string(i)).c_str());
+    lua_rawsetrange(L, -5, 1, 4);
+
+    lua_gc(L, LUA_GCCOLLECT, 0);
+
+    lua_rawgetrange(L, -1, 1, 4);
+    for (int i = 0; i < 4; ++i)
+        CHECK(lua_tostring(L, -4 + i) == "value-" + std::to_string(i));
+    lua_pop(L, 5);
+}
+
 TEST_CASE("ApiCalls")
 {
     StateRef globalState = runConformance("apicalls.lua");
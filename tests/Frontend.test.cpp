@@ -163,6 +163,107 @@ TEST_CASE_FIXTURE(FrontendFixture, "automatically_check_dependent_scripts")
     CHECK_EQ("{| b_value: number |}", toString(*bExports));
 }
 
+TEST_CASE_FIXTURE(FrontendFixture, "check_dependent_scripts_with_parse_workers")
+{
+    fileResolver.source["game/Gui/Modules/A"] = "return {hello=5, world=true}";
+    fileResolver.source["game/Gui/Modules/B"] = R"(
+        local Modules = game:GetService('Gui').Modules
+        local A = require(Modules.A)
+        return {b_value = A.hello}
+    )";
+
+    FrontendOptions options;
+    options.parseWorkers = 4;
+
+    CheckResult result = frontend.check("game/Gui/Modules/B", options);
+    LUAU_REQUIRE_NO_ERRORS(result);
+
+    ModulePtr bModule = frontend.moduleResolver.modules["game/Gui/Modules/B"];
+    REQUIRE(bModule != nullptr);
+
+    auto bExports = first(bModule->getModuleScope()->returnType);
+    REQUIRE(!!bExports);
+
+    CHECK_EQ("{| b_value: number |}", toString(*bExports));
+}
+
+TEST_CASE_FIXTURE(FrontendFixture, "incremental_recheck_reuses_results_when_interface_is_stable")
+{
+    fileResolver.source["game/Gui/Modules/A"] = "return {hello=5}";
+    fileResolver.source["game/Gui/Modules/B"] = R"(
+        local Modules = game:GetService('Gui').Modules
+        local A = require(Modules.A)
+        return {b_value = A.hello}
+    )";
+
+    FrontendOptions options;
+    options.incrementalRecheck = true;
+
+    frontend.check("game/Gui/Modules/B", options);
+
+    ModulePtr bBefore = frontend.moduleResolver.modules["game/Gui/Modules/B"];
+    REQUIRE(bBefore != nullptr);
+
+    // Same exported surface, different value: B should not be re-checked.
+    fileResolver.source["game/Gui/Modules/A"] = "return {hello=42}";
+    frontend.markDirty("game/Gui/Modules/A");
+
+    CheckResult result = frontend.check("game/Gui/Modules/B", options);
+    LUAU_REQUIRE_NO_ERRORS(result);
+
+    CHECK_EQ(frontend.moduleResolver.modules["game/Gui/Modules/B"], bBefore);
+
+    // Changing the exported surface must propagate to B.
+    fileResolver.source["game/Gui/Modules/A"] = "return {hello='five'}";
+    frontend.markDirty("game/Gui/Modules/A");
+
+    frontend.check("game/Gui/Modules/B", options);
+
+    ModulePtr bAfter = frontend.moduleResolver.modules["game/Gui/Modules/B"];
+    REQUIRE(bAfter != nullptr);
+    CHECK(bAfter != bBefore);
+
+    auto bExports = first(bAfter->getModuleScope()->returnType);
+    REQUIRE(!!bExports);
+    CHECK_EQ("{| b_value: string |}", toString(*bExports));
+}
+
+TEST_CASE_FIXTURE(FrontendFixture, "unchanged_sources_reuse_ast_on_recheck")
+{
+    fileResolver.source["game/Gui/Modules/A"] = "return {hello=5}";
+    fileResolver.source["game/Gui/Modules/B"] = R"(
+        local Modules = game:GetService('Gui').Modules
+        local A = require(Modules.A)
+        return {b_value = A.hello}
+    )";
+
+    frontend.check("game/Gui/Modules/B");
+
+    SourceModule* bBefore = frontend.getSourceModule("game/Gui/Modules/B");
+    REQUIRE(bBefore);
+    AstStatBlock* astBefore = bBefore->root;
+
+    // only A changed; B is transitively dirty but its AST is reused
+    fileResolver.source["game/Gui/Modules/A"] = "return {hello=42}";
+    frontend.markDirty("game/Gui/Modules/A");
+
+    CheckResult result = frontend.check("game/Gui/Modules/B");
+    LUAU_REQUIRE_NO_ERRORS(result);
+
+    SourceModule* bAfter = frontend.getSourceModule("game/Gui/Modules/B");
+    REQUIRE(bAfter);
+    CHECK_EQ(astBefore, bAfter->root);
+
+    // a real edit to B does trigger a re-parse
+    fileResolver.source["game/Gui/Modules/B"] = "return {b_value = 1}";
+    frontend.markDirty("game/Gui/Modules/B");
+    frontend.check("game/Gui/Modules/B");
+
+    SourceModule* bEdited = frontend.getSourceModule("game/Gui/Modules/B");
+    REQUIRE(bEdited);
+    CHECK(bEdited->root != astBefore);
+}
+
 TEST_CASE_FIXTURE(FrontendFixture, "automatically_check_cyclically_dependent_scripts")
 {
     fileResolver.source["game/Gui/Modules/A"] = R"(
@@ -914,6 +1015,10 @@ TEST_CASE_FIXTURE(FrontendFixture, "stats_are_not_reset_between_checks")
     Frontend::Stats stats1 = frontend.stats;
     CHECK_EQ(2, stats1.files);
 
+    // modify the sources so that the dirty modules actually need a re-parse
+    fileResolver.source["Module/A"] += "-- touch\n";
+    fileResolver.source["Module/B"] += "-- touch\n";
+
     frontend.markDirty("Module/A");
     frontend.markDirty("Module/B");
 
@@ -943,6 +1048,9 @@ TEST_CASE_FIXTURE(FrontendFixture, "clearStats")
     Frontend::Stats stats1 = frontend.stats;
     CHECK_EQ(2, stats1.files);
 
+    fileResolver.source["Module/A"] += "-- touch\n";
+    fileResolver.source["Module/B"] += "-- touch\n";
+
     frontend.markDirty("Module/A");
     frontend.markDirty("Module/B");
 
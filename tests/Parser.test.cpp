@@ -141,6 +141,80 @@ TEST_CASE("comment_skipped")
     CHECK_EQ(lexer.next().type, Lexeme::Type::Eof);
 }
 
+TEST_CASE("name_table_layered_over_parent")
+{
+    Luau::Allocator parentAlloc;
+    AstNameTable parentTable(parentAlloc);
+
+    AstName hello = parentTable.getOrAdd("hello");
+
+    Luau::Allocator alloc;
+    AstNameTable table(alloc, &parentTable);
+
+    // names known to the parent resolve to the parent's interned pointer
+    CHECK_EQ(table.getOrAdd("hello").value, hello.value);
+    CHECK_EQ(table.get("hello").value, hello.value);
+
+    // reserved words are found through the parent
+    CHECK_EQ(table.getOrAddWithType("end", 3).second, Lexeme::ReservedEnd);
+
+    // novel names are interned locally and don't leak into the parent
+    AstName novel = table.getOrAdd("novel");
+    CHECK(novel.value != nullptr);
+    CHECK_EQ(table.getOrAdd("novel").value, novel.value);
+    CHECK_EQ(parentTable.get("novel").value, nullptr);
+
+    // a lexer running over the layered table reuses parent names
+    const std::string testInput = "hello";
+    Lexer lexer(testInput.c_str(), testInput.size(), table);
+    Lexeme lexeme = lexer.next();
+    CHECK_EQ(lexeme.type, Lexeme::Type::Name);
+    CHECK_EQ(lexeme.name, hello.value);
+
+    // a table layered over a layered parent still sees the whole chain, reserved words included
+    Luau::Allocator grandchildAlloc;
+    AstNameTable grandchildTable(grandchildAlloc, &table);
+
+    CHECK_EQ(grandchildTable.getOrAdd("hello").value, hello.value);
+    CHECK_EQ(grandchildTable.getOrAdd("novel").value, novel.value);
+    CHECK_EQ(grandchildTable.getOrAddWithType("end", 3).second, Lexeme::ReservedEnd);
+}
+
+TEST_CASE("parse_with_layered_name_table_resolves_self")
+{
+    // the parser interns 'self' via addStatic; when the parent already holds it, the implicit
+    // method local and the lexed tokens must agree on one pointer or 'self' degrades to a global
+    Luau::Allocator parentAlloc;
+    AstNameTable parentTable(parentAlloc);
+    parentTable.getOrAdd("self");
+
+    Luau::Allocator alloc;
+    AstNameTable table(alloc, &parentTable);
+
+    const std::string source = R"(
+        local t = {}
+        function t:m()
+            return self
+        end
+    )";
+
+    ParseResult result = Parser::parse(source.c_str(), source.size(), table, alloc);
+    REQUIRE(result.errors.empty());
+    REQUIRE(result.root->body.size == 2);
+
+    AstStatFunction* method = result.root->body.data[1]->as<AstStatFunction>();
+    REQUIRE(method != nullptr);
+    REQUIRE(method->func->self != nullptr);
+
+    AstStatReturn* ret = method->func->body->body.data[0]->as<AstStatReturn>();
+    REQUIRE(ret != nullptr);
+    REQUIRE(ret->list.size == 1);
+
+    AstExprLocal* selfExpr = ret->list.data[0]->as<AstExprLocal>();
+    REQUIRE(selfExpr != nullptr);
+    CHECK_EQ(selfExpr->local, method->func->self);
+}
+
 TEST_CASE("multilineCommentWithLexemeInAndAfter")
 {
     const std::string testInput = "--[[ function \n"
@@ -182,9 +182,9 @@ assert((function() local a = {} for k,v in pairs({a=1, b=2, c=3}) do a[k] = 1 en
 assert((function() local a = {} for k,v in pairs({a=1, b=2, c=3}) do a[k] = v end return a.a + a.b + a.c end)() == 6)
 
 -- pairs on mixed array/table + gaps in the array portion
--- note that a,b,c results in a,c,b during traversal since index is based on hash & size
-assert((function() local a = {} for k,v in pairs({1, 2, 3, a=5, b=6, c=7}) do a[#a+1] = v end return table.concat(a, ',') end)() == "1,2,3,5,7,6")
-assert((function() local a = {} for k,v in pairs({1, 2, 3, nil, 4, a=5, b=6, c=7}) do a[#a+1] = v end return table.concat(a, ',') end)() == "1,2,3,4,5,7,6")
+-- the array part is visited first and in order; hash part order depends on the string hash in use, so it is sorted before comparing
+assert((function() local a = {} local h = {} for k,v in pairs({1, 2, 3, a=5, b=6, c=7}) do if type(k) == "number" then a[#a+1] = v else h[#h+1] = v end end table.sort(h) return table.concat(a, ',') .. ',' .. table.concat(h, ',') end)() == "1,2,3,5,6,7")
+assert((function() local a = {} local h = {} for k,v in pairs({1, 2, 3, nil, 4, a=5, b=6, c=7}) do if type(k) == "number" then a[#a+1] = v else h[#h+1] = v end end table.sort(h) return table.concat(a, ',') .. ',' .. table.concat(h, ',') end)() == "1,2,3,4,5,6,7")
 
 -- pairs manually
 assert((function() local a = '' for k in next,{5, 6, 7} do a = a .. k end return a end)() == "123")
@@ -257,8 +257,10 @@ assert((function()
     }
     local result = ""
     for k in pairs(kSelectedBiomes) do result = result .. k end
-    return result
-end)() == "ArcticDunesCanyonsWaterMountainsHillsLavaflowPlainsMarsh")
+    -- the exact order is deterministic for a given string hash; LuauWordStringHash changes it
+    return result == "ArcticDunesCanyonsWaterMountainsHillsLavaflowPlainsMarsh"
+        or result == "WaterMountainsDunesLavaflowMarshCanyonsArcticHillsPlains"
+end)())
 
 -- multiple returns
 -- local=
@@ -0,0 +1,57 @@
+-- This file is part of the Luau programming language and is licensed under MIT License; see LICENSE.txt for details
+print("testing closure caching")
+
+local function make(x)
+    return function() return x end
+end
+
+-- identical value captures let the closure be shared
+local f1 = make(5)
+local f2 = make(5)
+assert(f1 == f2)
+assert(f1() == 5)
+
+-- different captures produce distinct closures
+local f3 = make(6)
+assert(f3 ~= f1)
+assert(f3() == 6)
+assert(f1() == 5)
+
+-- 0 and -0 compare equal but are distinguishable through division; they must not share
+local pz = make(0.0)
+local nz = make(-0.0)
+assert(pz ~= nz)
+assert(1 / pz() == math.huge)
+assert(1 / nz() == -math.huge)
+
+-- mutable (ref) captures behave differently per instance and are never shared
+local function makecounter()
+    local n = 0
+    return function()
+        n += 1
+        return n
+    end
+end
+
+local c1 = makecounter()
+local c2 = makecounter()
+assert(c1 ~= c2)
+assert(c1() == 1)
+assert(c1() == 2)
+assert(c2() == 1)
+
+-- a cached closure that is still referenced keeps working across a full collection
+local g1 = make(9)
+collectgarbage()
+local g2 = make(9)
+assert(g1() == 9)
+assert(g2() == 9)
+
+-- when nothing references the cached closure, collection clears the weak cache entry and the
+-- next creation simply makes a fresh closure
+make(11)
+collectgarbage()
+local h = make(11)
+assert(h() == 11)
+
+return "OK"
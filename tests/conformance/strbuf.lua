@@ -0,0 +1,52 @@
+-- This file is part of the Luau programming language and is licensed under MIT License; see LICENSE.txt for details
+print("testing string buffers")
+
+-- basic append/tostring
+local b = strbuf.create(64)
+assert(typeof(b) == "strbuf")
+assert(b:len() == 0)
+assert(b:capacity() == 64)
+
+b:append("hello")
+b:append(" ", "world")
+assert(b:len() == 11)
+assert(b:tostring() == "hello world")
+assert(tostring(b) == "hello world")
+assert(#b == 11)
+
+-- chaining and number coercion
+local c = strbuf.create(32):append("x="):append(42)
+assert(c:tostring() == "x=42")
+
+-- clear resets length, retains capacity
+c:clear()
+assert(c:len() == 0 and c:capacity() == 32)
+assert(c:tostring() == "")
+
+-- payload assembly in a loop stays linear
+local p = strbuf.create(4000)
+for i = 1, 1000 do
+    p:append("abcd")
+end
+assert(#p == 4000)
+assert(p:tostring() == string.rep("abcd", 1000))
+
+-- capacity overflow errors without corrupting the buffer
+local small = strbuf.create(4)
+small:append("1234")
+local ok, err = pcall(function() small:append("5") end)
+assert(not ok and err:find("capacity exceeded"))
+assert(small:tostring() == "1234")
+
+-- zero-capacity buffers work
+local z = strbuf.create(0)
+assert(z:tostring() == "" and #z == 0)
+
+-- type errors
+assert(not pcall(function() strbuf.create(-1) end))
+assert(not pcall(function() return strbuf.create(8).append({}, "x") end))
+
+-- the shared metatable is locked
+assert(getmetatable(strbuf.create(1)) == "The metatable is locked")
+
+return "OK"